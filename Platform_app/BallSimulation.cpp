@@ -0,0 +1,225 @@
+#include "BallSimulation.h"
+#include "PlatformSample.h"
+
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+const float kBallRadius = 0.5f;
+const float kPlatformTop = 0.25f;
+const float kStartHeight = 2.0f;
+
+// Obrot wektora kwaternionem (w, x, y, z)
+BallSimulation::Vec3 rotate(const float q[4], const BallSimulation::Vec3 &v)
+{
+    const float w = q[0], x = q[1], y = q[2], z = q[3];
+
+    // t = 2 * (q.xyz x v)
+    const float tx = 2.0f * (y * v.z - z * v.y);
+    const float ty = 2.0f * (z * v.x - x * v.z);
+    const float tz = 2.0f * (x * v.y - y * v.x);
+
+    // v' = v + w * t + q.xyz x t
+    BallSimulation::Vec3 r;
+    r.x = v.x + w * tx + (y * tz - z * ty);
+    r.y = v.y + w * ty + (z * tx - x * tz);
+    r.z = v.z + w * tz + (x * ty - y * tx);
+    return r;
+}
+
+} // namespace
+
+// Konstruktor - krok staly, tarcie przeliczone z 0.98 na klatke 16 ms
+BallSimulation::BallSimulation(int rateHz)
+    : m_stepNs(1000000000LL / (rateHz > 0 ? rateHz : 1000)),
+      m_dt(m_stepNs * 1e-9f),
+      m_friction(std::pow(0.98f, m_dt / 0.016f)),
+      m_renderDelayNs(m_stepNs * 2 + 2000000)
+{
+    m_position.y = kStartHeight;
+}
+
+BallSimulation::~BallSimulation()
+{
+    stop();
+}
+
+// Uruchomienie watku symulacji
+void BallSimulation::start()
+{
+    if (m_thread.joinable()) return;
+
+    m_stopping.store(false, std::memory_order_relaxed);
+    m_thread = std::thread(&BallSimulation::run, this);
+}
+
+// Zatrzymanie watku symulacji
+void BallSimulation::stop()
+{
+    if (!m_thread.joinable()) return;
+
+    m_stopping.store(true, std::memory_order_relaxed);
+    m_thread.join();
+}
+
+// Nowa orientacja platformy (dowolny watek)
+void BallSimulation::setPlatformOrientation(float w, float x, float y, float z)
+{
+    std::lock_guard<std::mutex> lock(m_paramsMutex);
+    m_params.rotation[0] = w;
+    m_params.rotation[1] = x;
+    m_params.rotation[2] = y;
+    m_params.rotation[3] = z;
+    m_paramsVersion.fetch_add(1, std::memory_order_release);
+}
+
+// Nowa wartosc grawitacji (dowolny watek)
+void BallSimulation::setGravity(float gravity)
+{
+    std::lock_guard<std::mutex> lock(m_paramsMutex);
+    m_params.gravity = gravity;
+    m_paramsVersion.fetch_add(1, std::memory_order_release);
+}
+
+// Zadanie resetu - wykonywane przez watek symulacji
+void BallSimulation::reset()
+{
+    m_resetRequested.store(true, std::memory_order_release);
+}
+
+// Petla symulacji ze stalym krokiem
+void BallSimulation::run()
+{
+    Params params;
+    uint32_t paramsVersion = m_paramsVersion.load(std::memory_order_acquire) - 1;
+
+    int64_t last = monotonicNowNs();
+    int64_t simNs = last;
+    int64_t accumulator = 0;
+    publish(simNs);
+
+    while (!m_stopping.load(std::memory_order_relaxed)) {
+        // Kopia parametrow tylko po zmianie
+        const uint32_t version = m_paramsVersion.load(std::memory_order_acquire);
+        if (version != paramsVersion) {
+            std::lock_guard<std::mutex> lock(m_paramsMutex);
+            params = m_params;
+            paramsVersion = version;
+        }
+
+        if (m_resetRequested.exchange(false, std::memory_order_acq_rel)) {
+            m_position = Vec3();
+            m_position.y = kStartHeight;
+            m_velocity = Vec3();
+        }
+
+        const int64_t now = monotonicNowNs();
+        accumulator += now - last;
+        last = now;
+
+        // Dluga przerwa (np. uspienie systemu) - pominiecie zamiast nadrabiania
+        if (accumulator > kMaxLagNs) {
+            simNs += accumulator - m_stepNs;
+            accumulator = m_stepNs;
+        }
+
+        // Podkroki nadrabiajace opoznienie watku
+        while (accumulator >= m_stepNs) {
+            integrate(params);
+            simNs += m_stepNs;
+            accumulator -= m_stepNs;
+            m_steps.fetch_add(1, std::memory_order_relaxed);
+            publish(simNs);
+        }
+
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(
+            std::chrono::nanoseconds(last + m_stepNs - accumulator)));
+    }
+}
+
+// Jeden krok fizyki pilki
+void BallSimulation::integrate(const Params &params)
+{
+    // Normalna platformy
+    Vec3 up;
+    up.y = 1.0f;
+    const Vec3 normal = rotate(params.rotation, up);
+
+    // Projekcja grawitacji na platforme
+    const float gn = -params.gravity * normal.y;
+    m_velocity.x += (-gn * normal.x) * m_dt;
+    m_velocity.y += (-params.gravity - gn * normal.y) * m_dt;
+    m_velocity.z += (-gn * normal.z) * m_dt;
+
+    // Wysokosc platformy pod pilka
+    const float d = normal.y * kPlatformTop;
+    const float platformY = (d - normal.x * m_position.x - normal.z * m_position.z) / normal.y;
+
+    // Sprawdzenie czy pilka jest na platformie
+    const float edgeMargin = kBallRadius * (2.0f / 3.0f);
+    const bool onPlatform =
+        m_position.x >= -3.0f + edgeMargin && m_position.x <= 3.0f - edgeMargin &&
+        m_position.z >= -2.0f + edgeMargin && m_position.z <= 2.0f - edgeMargin;
+
+    if (onPlatform && m_position.y - kBallRadius <= platformY) {
+        // Pilka lezy na platformie
+        m_position.y = platformY + kBallRadius;
+        m_velocity.y = 0.0f;
+    } else {
+        // Swobodny spadek
+        m_velocity.y -= params.gravity * m_dt;
+    }
+
+    // Tarcie
+    m_velocity.x *= m_friction;
+    m_velocity.z *= m_friction;
+
+    m_position.x += m_velocity.x * m_dt;
+    m_position.y += m_velocity.y * m_dt;
+    m_position.z += m_velocity.z * m_dt;
+}
+
+// Publikacja stanu dla watku renderowania
+void BallSimulation::publish(int64_t timeNs)
+{
+    std::lock_guard<std::mutex> lock(m_historyMutex);
+    Snapshot &snapshot = m_history[m_historyHead];
+    snapshot.timeNs = timeNs;
+    snapshot.position = m_position;
+    m_historyHead = (m_historyHead + 1) % kHistorySize;
+    if (m_historyCount < kHistorySize) ++m_historyCount;
+}
+
+// Pozycja do wyswietlenia - interpolacja miedzy stanami symulacji
+BallSimulation::Vec3 BallSimulation::position(int64_t nowNs) const
+{
+    const int64_t target = nowNs - m_renderDelayNs;
+
+    std::lock_guard<std::mutex> lock(m_historyMutex);
+    if (m_historyCount == 0) {
+        Vec3 start;
+        start.y = kStartHeight;
+        return start;
+    }
+
+    // Od najnowszego stanu wstecz do pierwszego nie pozniejszego niz target
+    int newer = (m_historyHead + kHistorySize - 1) % kHistorySize;
+    if (m_history[newer].timeNs <= target) return m_history[newer].position;
+
+    for (int i = 1; i < m_historyCount; ++i) {
+        const int older = (newer + kHistorySize - 1) % kHistorySize;
+        const Snapshot &a = m_history[older];
+        const Snapshot &b = m_history[newer];
+        if (a.timeNs <= target) {
+            const float t = static_cast<float>(target - a.timeNs) / static_cast<float>(b.timeNs - a.timeNs);
+            Vec3 p;
+            p.x = a.position.x + (b.position.x - a.position.x) * t;
+            p.y = a.position.y + (b.position.y - a.position.y) * t;
+            p.z = a.position.z + (b.position.z - a.position.z) * t;
+            return p;
+        }
+        newer = older;
+    }
+    return m_history[newer].position;
+}
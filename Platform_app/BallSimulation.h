@@ -0,0 +1,175 @@
+/**
+ * @file    BallSimulation.h
+ * @brief   Fixed-timestep ball physics on a dedicated thread
+ *
+ * @details Runs the virtual ball independently of the GUI:
+ *          - Constant step (1 kHz by default) with an accumulator, so the
+ *            result does not depend on timer jitter or the render rate
+ *          - Late wake-ups are caught up with several substeps
+ *          - Inputs are snapshotted once per wake-up, not read per step
+ *          - The render side interpolates between published states
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef BALLSIMULATION_H
+#define BALLSIMULATION_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class BallSimulation
+ * @brief Ball rolling on the tilted platform, simulated in real time
+ *
+ * @details Uses the scene frame of PlatformViewer (y up). The setters and
+ *          position() may be called from any thread; the physics state is
+ *          owned by the simulation thread.
+ */
+class BallSimulation
+{
+public:
+    /**
+     * @struct Vec3
+     * @brief Position in scene units
+     */
+    struct Vec3 {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
+    /**
+     * @brief Creates a stopped simulation with the ball above the platform
+     * @param rateHz Physics steps per second
+     */
+    explicit BallSimulation(int rateHz = 1000);
+
+    /**
+     * @brief Stops the simulation thread
+     */
+    ~BallSimulation();
+
+    BallSimulation(const BallSimulation&) = delete;
+    BallSimulation& operator=(const BallSimulation&) = delete;
+
+    /**
+     * @brief Starts the simulation thread (no-op if running)
+     */
+    void start();
+
+    /**
+     * @brief Stops and joins the simulation thread
+     */
+    void stop();
+
+    /**
+     * @brief Sets the platform rotation used from the next wake-up
+     * @param w,x,y,z Rotation quaternion in the scene frame
+     */
+    void setPlatformOrientation(float w, float x, float y, float z);
+
+    /**
+     * @brief Sets the gravity magnitude used from the next wake-up
+     * @param gravity Gravity in scene units per s²
+     */
+    void setGravity(float gravity);
+
+    /**
+     * @brief Puts the ball back above the platform centre at rest
+     */
+    void reset();
+
+    /**
+     * @brief Ball position for rendering
+     * @param nowNs Current monotonicNowNs() time
+     * @return Position interpolated between the two simulated states
+     *         around nowNs - renderDelayNs()
+     */
+    Vec3 position(int64_t nowNs) const;
+
+    /**
+     * @brief Duration of one physics step
+     */
+    int64_t stepNs() const { return m_stepNs; }
+
+    /**
+     * @brief How far rendering lags the newest state
+     *
+     * @details Covers the sleep granularity of the simulation thread, so
+     *          a state after the render time is normally available.
+     */
+    int64_t renderDelayNs() const { return m_renderDelayNs; }
+
+    /**
+     * @brief Physics steps executed since start()
+     */
+    uint64_t steps() const { return m_steps.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr int kHistorySize = 64;             ///< Published states kept for interpolation
+    static constexpr int64_t kMaxLagNs = 100000000;     ///< Longer stalls are skipped, not replayed
+
+    /**
+     * @struct Params
+     * @brief Inputs copied by the simulation thread
+     */
+    struct Params {
+        float rotation[4] = { 1.0f, 0.0f, 0.0f, 0.0f }; ///< Platform quaternion (w, x, y, z)
+        float gravity = 9.8f;                            ///< Gravity magnitude
+    };
+
+    /**
+     * @struct Snapshot
+     * @brief Published ball position at a simulated time
+     */
+    struct Snapshot {
+        int64_t timeNs = 0;     ///< Simulated time (monotonicNowNs() clock)
+        Vec3 position;          ///< Ball centre
+    };
+
+    /**
+     * @brief Simulation thread body
+     */
+    void run();
+
+    /**
+     * @brief Advances the ball by one step
+     */
+    void integrate(const Params &params);
+
+    /**
+     * @brief Stores a state for position()
+     */
+    void publish(int64_t timeNs);
+
+    const int64_t m_stepNs;             ///< Step length (ns)
+    const float m_dt;                   ///< Step length (s)
+    const float m_friction;             ///< Horizontal velocity factor per step
+    const int64_t m_renderDelayNs;      ///< Interpolation delay
+
+    // Stan fizyki - tylko watek symulacji
+    Vec3 m_position;                    ///< Ball centre
+    Vec3 m_velocity;                    ///< Ball velocity
+
+    mutable std::mutex m_paramsMutex;   ///< Guards m_params
+    Params m_params;                    ///< Latest inputs
+    std::atomic<uint32_t> m_paramsVersion{0};   ///< Incremented on every input change
+    std::atomic<bool> m_resetRequested{false};  ///< reset() called
+
+    mutable std::mutex m_historyMutex;  ///< Guards m_history and m_historyHead
+    std::array<Snapshot, kHistorySize> m_history;   ///< Ring of published states
+    int m_historyHead = 0;              ///< Next slot to write
+    int m_historyCount = 0;             ///< Valid entries
+
+    std::atomic<bool> m_stopping{false};    ///< Request for the thread to exit
+    std::atomic<uint64_t> m_steps{0};       ///< Executed steps
+    std::thread m_thread;                   ///< Simulation thread
+};
+
+#endif // BALLSIMULATION_H
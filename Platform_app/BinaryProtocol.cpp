@@ -0,0 +1,121 @@
+#include "BinaryProtocol.h"
+#include "Crc16.h"
+
+namespace {
+
+// Zapis/odczyt little-endian
+inline void putU16(uint8_t *p, uint16_t v)
+{
+    p[0] = static_cast<uint8_t>(v & 0xFF);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+inline uint16_t getU16(const uint8_t *p)
+{
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+// Dekodowanie COBS; zwraca liczbe bajtow albo 0 przy bledzie
+std::size_t cobsDecode(const uint8_t *src, std::size_t size, uint8_t *dst, std::size_t capacity)
+{
+    std::size_t in = 0;
+    std::size_t out = 0;
+    while (in < size) {
+        const uint8_t code = src[in++];
+        if (code == 0) return 0;
+
+        for (uint8_t i = 1; i < code; ++i) {
+            if (in >= size || out >= capacity || src[in] == 0) return 0;
+            dst[out++] = src[in++];
+        }
+
+        // Niejawne zero po bloku (poza ostatnim i blokiem 0xFF)
+        if (code != 0xFF && in < size) {
+            if (out >= capacity) return 0;
+            dst[out++] = 0;
+        }
+    }
+    return out;
+}
+
+// Kodowanie COBS z zakonczeniem 0x00; zwraca liczbe bajtow
+std::size_t cobsEncode(const uint8_t *src, std::size_t size, uint8_t *dst)
+{
+    std::size_t codeIndex = 0;
+    std::size_t out = 1;
+    uint8_t code = 1;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        if (src[i] == 0) {
+            dst[codeIndex] = code;
+            codeIndex = out++;
+            code = 1;
+        } else {
+            dst[out++] = src[i];
+            if (++code == 0xFF) {
+                dst[codeIndex] = code;
+                codeIndex = out++;
+                code = 1;
+            }
+        }
+    }
+    dst[codeIndex] = code;
+    dst[out++] = 0;
+    return out;
+}
+
+} // namespace
+
+// Kodowanie probki do ramki binarnej
+std::size_t BinaryProtocol::encode(const PlatformSample &sample, uint16_t sequence, uint8_t *out)
+{
+    uint8_t record[kRecordSize];
+    const bool servo = (sample.type == PlatformSample::Type::Servo);
+    record[0] = servo ? kServoRecord : kImuRecord;
+    record[1] = servo ? 0 : static_cast<uint8_t>(sample.imuId);
+    putU16(record + 2, sequence);
+    for (int i = 0; i < 6; ++i)
+        putU16(record + 4 + 2 * i, static_cast<uint16_t>(sample.values[i]));
+    putU16(record + 16, crc16(record, 16));
+
+    return cobsEncode(record, kRecordSize, out);
+}
+
+// Dekodowanie ramki binarnej
+BinaryProtocol::Result BinaryProtocol::decode(std::string_view frame, PlatformSample &sample)
+{
+    Result result;
+    uint8_t record[kRecordSize];
+
+    const std::size_t size = cobsDecode(reinterpret_cast<const uint8_t *>(frame.data()), frame.size(),
+                                        record, kRecordSize);
+    if (size != kRecordSize) {
+        result.status = Status::BadFraming;
+        return result;
+    }
+
+    if (record[0] == kImuRecord) {
+        result.type = PlatformSample::Type::Imu;
+    } else if (record[0] == kServoRecord) {
+        result.type = PlatformSample::Type::Servo;
+    } else {
+        result.status = Status::BadType;
+        return result;
+    }
+
+    result.sequence = getU16(record + 2);
+    result.receivedCrc = getU16(record + 16);
+    result.calculatedCrc = crc16(record, 16);
+    if (result.receivedCrc != result.calculatedCrc) {
+        result.status = Status::CrcMismatch;
+        return result;
+    }
+
+    sample.type = result.type;
+    sample.imuId = (result.type == PlatformSample::Type::Imu) ? record[1] : 0;
+    for (int i = 0; i < 6; ++i)
+        sample.values[i] = static_cast<int16_t>(getU16(record + 4 + 2 * i));
+
+    result.status = Status::Ok;
+    return result;
+}
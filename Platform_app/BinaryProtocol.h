@@ -0,0 +1,88 @@
+/**
+ * @file    BinaryProtocol.h
+ * @brief   Compact binary framing for IMU and servo samples
+ *
+ * @details Optional alternative to the ASCII protocol for higher sample
+ *          rates. Every sample is a fixed-size little-endian record:
+ *
+ * | Offset | Size | Field                                   |
+ * |--------|------|-----------------------------------------|
+ * | 0      | 1    | Record type (0xA1 = IMU, 0xA2 = servo)  |
+ * | 1      | 1    | IMU id (0 for servo records)            |
+ * | 2      | 2    | Sequence number (wraps at 65536)        |
+ * | 4      | 12   | Six int16 values (same order as ASCII)  |
+ * | 16     | 2    | CRC-16/CCITT-FALSE over bytes 0..15     |
+ *
+ *          Records are COBS encoded and terminated with a 0x00 byte, so one
+ *          sample costs 20 bytes on the wire instead of ~40 for the text
+ *          format. The delimiter never occurs in ASCII frames, which lets
+ *          the receiver detect the protocol automatically.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef BINARYPROTOCOL_H
+#define BINARYPROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "PlatformSample.h"
+
+/**
+ * @class BinaryProtocol
+ * @brief Encoder and decoder for COBS framed binary records
+ */
+class BinaryProtocol
+{
+public:
+    static constexpr uint8_t kImuRecord = 0xA1;             ///< Record type of IMU samples
+    static constexpr uint8_t kServoRecord = 0xA2;           ///< Record type of servo samples
+    static constexpr std::size_t kRecordSize = 18;          ///< Decoded record size in bytes
+    static constexpr std::size_t kMaxFrameSize = kRecordSize + 2; ///< Encoded size incl. COBS code and delimiter
+
+    /**
+     * @enum Status
+     * @brief Outcome of decoding a frame
+     */
+    enum class Status {
+        Ok,           ///< Valid record, sample filled in
+        BadFraming,   ///< Invalid COBS encoding or wrong record length
+        BadType,      ///< Unknown record type
+        CrcMismatch   ///< CRC-16 does not match the record
+    };
+
+    /**
+     * @struct Result
+     * @brief Status together with record details for diagnostics
+     */
+    struct Result {
+        Status status = Status::BadFraming;                     ///< Decoding outcome
+        PlatformSample::Type type = PlatformSample::Type::Imu; ///< Record type
+        uint16_t sequence = 0;                                 ///< Sender's sequence number
+        uint16_t receivedCrc = 0;                              ///< CRC sent in the record
+        uint16_t calculatedCrc = 0;                            ///< CRC computed over the record
+    };
+
+    /**
+     * @brief Encodes a sample into a delimited frame
+     * @param sample Sample to send (timestamp is not transmitted)
+     * @param sequence Sequence number of the record
+     * @param out Destination with room for kMaxFrameSize bytes
+     * @return Number of bytes written, including the 0x00 delimiter
+     */
+    static std::size_t encode(const PlatformSample &sample, uint16_t sequence, uint8_t *out);
+
+    /**
+     * @brief Decodes one frame
+     * @param frame COBS encoded bytes without the 0x00 delimiter
+     * @param sample Receives type, IMU id and values when the status is Ok
+     * @return Decoding result
+     */
+    static Result decode(std::string_view frame, PlatformSample &sample);
+};
+
+#endif // BINARYPROTOCOL_H
@@ -0,0 +1,59 @@
+/**
+ * @file    Crc16.h
+ * @brief   Table-driven CRC-16/CCITT-FALSE for binary frames
+ *
+ * @details Polynomial 0x1021, initial value 0xFFFF, no reflection and no
+ *          final XOR. The lookup table is generated at compile time.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct Crc16Table
+ * @brief Precomputed CRC-16 remainders for every byte value
+ */
+struct Crc16Table {
+    uint16_t value[256]; ///< Remainder of (byte << 8) for polynomial 0x1021
+};
+
+/**
+ * @brief Builds the CRC-16 lookup table
+ * @param poly Generator polynomial (without the x^16 term)
+ */
+constexpr Crc16Table makeCrc16Table(uint16_t poly = 0x1021)
+{
+    Crc16Table table{};
+    for (int i = 0; i < 256; ++i) {
+        uint16_t crc = static_cast<uint16_t>(i << 8);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ poly) : static_cast<uint16_t>(crc << 1);
+        table.value[i] = crc;
+    }
+    return table;
+}
+
+inline constexpr Crc16Table kCrc16Table = makeCrc16Table(); ///< Table for polynomial 0x1021
+inline constexpr uint16_t kCrc16Init = 0xFFFF;               ///< Initial CRC register value
+
+/**
+ * @brief Computes CRC-16/CCITT-FALSE over a byte range
+ * @param data Input bytes
+ * @param size Number of bytes
+ * @param crc Running CRC value (default: initial value)
+ */
+constexpr uint16_t crc16(const uint8_t *data, std::size_t size, uint16_t crc = kCrc16Init)
+{
+    for (std::size_t i = 0; i < size; ++i)
+        crc = static_cast<uint16_t>((crc << 8) ^ kCrc16Table.value[((crc >> 8) ^ data[i]) & 0xFF]);
+    return crc;
+}
+
+#endif // CRC16_H
@@ -0,0 +1,80 @@
+/**
+ * @file    Crc8.h
+ * @brief   Table-driven CRC-8 used by the serial frame protocol
+ *
+ * @details CRC-8 with polynomial 0x31 (x^8 + x^5 + x^4 + 1), initial value
+ *          0xFF, no reflection and no final XOR. Each 16-bit field is fed
+ *          LSB first, then MSB. The 256-entry lookup table is generated at
+ *          compile time, so an update costs one table load per byte instead
+ *          of eight shift/XOR steps.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef CRC8_H
+#define CRC8_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct Crc8Table
+ * @brief Precomputed CRC-8 remainders for every byte value
+ */
+struct Crc8Table {
+    uint8_t value[256]; ///< Remainder of (byte << 8) for polynomial 0x31
+};
+
+/**
+ * @brief Builds the CRC-8 lookup table
+ * @param poly Generator polynomial (without the x^8 term)
+ */
+constexpr Crc8Table makeCrc8Table(uint8_t poly = 0x31)
+{
+    Crc8Table table{};
+    for (int i = 0; i < 256; ++i) {
+        uint8_t crc = static_cast<uint8_t>(i);
+        for (int bit = 0; bit < 8; ++bit)
+            crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ poly) : static_cast<uint8_t>(crc << 1);
+        table.value[i] = crc;
+    }
+    return table;
+}
+
+inline constexpr Crc8Table kCrc8Table = makeCrc8Table(); ///< Table for polynomial 0x31
+inline constexpr uint8_t kCrc8Init = 0xFF;               ///< Initial CRC register value
+
+/**
+ * @brief Feeds one byte into the CRC
+ */
+constexpr uint8_t crc8Update(uint8_t crc, uint8_t byte)
+{
+    return kCrc8Table.value[crc ^ byte];
+}
+
+/**
+ * @brief Feeds one 16-bit field into the CRC (LSB first, then MSB)
+ */
+constexpr uint8_t crc8UpdateInt16(uint8_t crc, int16_t value)
+{
+    const uint16_t u = static_cast<uint16_t>(value);
+    crc = crc8Update(crc, static_cast<uint8_t>(u & 0xFF));
+    return crc8Update(crc, static_cast<uint8_t>(u >> 8));
+}
+
+/**
+ * @brief Computes the frame CRC over a list of 16-bit fields
+ * @param values Field values
+ * @param count Number of fields
+ */
+constexpr uint8_t crc8Int16(const int16_t *values, std::size_t count)
+{
+    uint8_t crc = kCrc8Init;
+    for (std::size_t i = 0; i < count; ++i)
+        crc = crc8UpdateInt16(crc, values[i]);
+    return crc;
+}
+
+#endif // CRC8_H
@@ -0,0 +1,190 @@
+#include "FrameDecoder.h"
+#include "Crc8.h"
+#include "FrameSchema.h"
+#include <cstring>
+
+namespace {
+
+// Biale znaki akceptowane wokol liczb (jak QByteArray::toInt)
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+// Wartosc cyfry szesnastkowej albo -1
+inline int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Parsowanie jednego pola liczbowego do ',' lub konca danych.
+// Zwraca wskaznik na separator; ok = false gdy pole nie jest poprawna liczba int.
+const char *parseField(const char *p, const char *end, int32_t &value, bool &ok)
+{
+    constexpr int64_t limit = int64_t(1) << 31;  // |INT_MIN|
+
+    ok = false;
+    while (p != end && isSpace(*p)) ++p;
+
+    bool negative = false;
+    if (p != end && (*p == '+' || *p == '-')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    int64_t acc = 0;
+    bool digits = false;
+    while (p != end && static_cast<unsigned>(*p - '0') < 10u) {
+        acc = acc * 10 + (*p - '0');
+        if (acc > limit) acc = limit + 1;  // Nasycenie - i tak poza zakresem
+        digits = true;
+        ++p;
+    }
+
+    while (p != end && isSpace(*p)) ++p;
+
+    // Niedozwolone znaki w polu - przejscie do nastepnego separatora
+    if (p != end && *p != ',') {
+        while (p != end && *p != ',') ++p;
+        return p;
+    }
+
+    if (negative) acc = -acc;
+    if (!digits || acc > limit - 1 || acc < -limit)
+        return p;
+
+    value = static_cast<int32_t>(acc);
+    ok = true;
+    return p;
+}
+
+// Pole sumy kontrolnej: dokladnie dwa znaki po ostatniej '*' (wspolne dla wszystkich typow ramek)
+bool parseCrcField(std::string_view line, std::size_t prefixLength, FrameDecoder::Result &result)
+{
+    const char *begin = line.data();
+    const std::size_t size = line.size();
+
+    if (size < prefixLength + 3 || begin[size - 3] != '*' || begin[size - 2] == '*' || begin[size - 1] == '*') {
+        const bool hasStar = std::memchr(begin + prefixLength, '*', size - prefixLength) != nullptr;
+        result.status = hasStar ? FrameDecoder::Status::BadCrcFormat : FrameDecoder::Status::Unrecognized;
+        return false;
+    }
+
+    const char c0 = begin[size - 2];
+    const char c1 = begin[size - 1];
+    const int h0 = hexValue(c0);
+    const int h1 = hexValue(c1);
+    if (h0 >= 0 && h1 >= 0) {
+        result.receivedCrc = static_cast<uint8_t>((h0 << 4) | h1);
+    } else if ((isSpace(c0) || c0 == '+') && h1 >= 0) {
+        result.receivedCrc = static_cast<uint8_t>(h1);
+    } else {
+        result.status = FrameDecoder::Status::BadCrcFormat;
+        return false;
+    }
+    return true;
+}
+
+// Stan jednego przebiegu po polach ramki
+struct FieldCursor {
+    const char *p;              // Biezaca pozycja
+    const char *end;            // Koniec danych (przed '*')
+    uint8_t crc = kCrc8Init;    // CRC pol objetych suma
+    bool countOk = true;        // Dotad tyle pol, ile w opisie
+    bool valuesOk = true;       // Wszystkie pola sa liczbami
+};
+
+// Jedno pole wedlug opisu z FrameSchema - rozwijane w czasie kompilacji
+template <typename Frame, std::size_t I>
+inline void decodeField(FieldCursor &cursor, PlatformSample &sample)
+{
+    using FieldType = typename Frame::Fields::template At<I>;
+    if (!cursor.countOk) return;
+
+    if (I > 0) {
+        if (cursor.p == cursor.end) {   // Za malo pol
+            cursor.countOk = false;
+            return;
+        }
+        ++cursor.p;  // Pominiecie ','
+    }
+
+    int32_t value = 0;
+    bool ok;
+    cursor.p = parseField(cursor.p, cursor.end, value, ok);
+    if (!ok) {
+        cursor.valuesOk = false;
+        return;
+    }
+
+    if constexpr (FieldType::kTarget == FieldTarget::ImuId) {
+        sample.imuId = value;
+        if constexpr (FieldType::kInCrc)
+            cursor.crc = crc8UpdateInt16(cursor.crc, static_cast<int16_t>(value));
+    } else {
+        const int16_t v16 = static_cast<int16_t>(value);
+        sample.values[Frame::Fields::template valueIndex<I>()] = v16;
+        if constexpr (FieldType::kInCrc)
+            cursor.crc = crc8UpdateInt16(cursor.crc, v16);
+    }
+}
+
+template <typename Frame, std::size_t... I>
+inline void decodeFields(FieldCursor &cursor, PlatformSample &sample, std::index_sequence<I...>)
+{
+    (decodeField<Frame, I>(cursor, sample), ...);
+}
+
+// Dekodowanie linii jako ramki typu Frame; false gdy prefiks nie pasuje
+template <typename Frame>
+inline bool decodeAs(std::string_view line, PlatformSample &sample, FrameDecoder::Result &result)
+{
+    if (line.compare(0, Frame::kPrefix.size(), Frame::kPrefix) != 0) return false;
+
+    result.type = Frame::kType;
+    if (!parseCrcField(line, Frame::kPrefix.size(), result)) return true;
+
+    // Jeden przebieg po polach: konwersja i aktualizacja CRC
+    FieldCursor cursor{ line.data() + Frame::kPrefix.size(), line.data() + line.size() - 3 };
+    decodeFields<Frame>(cursor, sample, std::make_index_sequence<Frame::Fields::kCount>());
+
+    if (!cursor.countOk || cursor.p != cursor.end) {   // Za malo lub za duzo pol
+        result.status = FrameDecoder::Status::BadFieldCount;
+        return true;
+    }
+    if (!cursor.valuesOk) {
+        result.status = FrameDecoder::Status::BadValue;
+        return true;
+    }
+
+    result.calculatedCrc = cursor.crc;
+    if (result.receivedCrc != cursor.crc) {
+        result.status = FrameDecoder::Status::CrcMismatch;
+        return true;
+    }
+
+    sample.type = Frame::kType;
+    result.status = FrameDecoder::Status::Ok;
+    return true;
+}
+
+// Proba kolejnych typow ramek w kolejnosci z AsciiFrames
+template <typename... Frames>
+inline FrameDecoder::Result dispatch(FrameSet<Frames...>, std::string_view line, PlatformSample &sample)
+{
+    FrameDecoder::Result result;
+    if (!(decodeAs<Frames>(line, sample, result) || ...))
+        result.status = FrameDecoder::Status::Unrecognized;
+    return result;
+}
+
+} // namespace
+
+// Dekodowanie jednej linii w jednym przebiegu (konwersja + CRC)
+FrameDecoder::Result FrameDecoder::decode(std::string_view line, PlatformSample &sample)
+{
+    return dispatch(AsciiFrames(), line, sample);
+}
@@ -0,0 +1,75 @@
+/**
+ * @file    FrameDecoder.h
+ * @brief   Single-pass decoder for ASCII IMU and servo frames
+ *
+ * @details Decodes the text protocol sent by the platform controller:
+ *          - "IMU:<id>,<ax>,<ay>,<az>,<gx>,<gy>,<gz>*<crc>"
+ *          - "S:<a1>,<a2>,<a3>,<a4>,<a5>,<a6>*<crc>"
+ *
+ *          The payload is walked once; integer conversion and the CRC-8
+ *          update happen in the same pass and nothing is allocated. The
+ *          prefix checks and the field loop are generated at compile time
+ *          from the frame descriptors in FrameSchema.h.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef FRAMEDECODER_H
+#define FRAMEDECODER_H
+
+#include <cstdint>
+#include <string_view>
+
+#include "PlatformSample.h"
+
+/**
+ * @class FrameDecoder
+ * @brief Validates and converts one framed text line
+ *
+ * @details Accepts exactly the frames the previous QByteArray-based parser
+ *          accepted: fields follow QByteArray::toInt() rules (surrounding
+ *          whitespace and a sign allowed, value within int range, truncated
+ *          to 16 bits) and the checksum must be a two-character hex field
+ *          after the last '*'.
+ */
+class FrameDecoder
+{
+public:
+    /**
+     * @enum Status
+     * @brief Outcome of decoding a line
+     */
+    enum class Status {
+        Ok,             ///< Valid frame, sample filled in
+        Unrecognized,   ///< Not a frame listed in AsciiFrames
+        BadCrcFormat,   ///< Checksum field is not two hex characters
+        BadFieldCount,  ///< Wrong number of comma separated fields
+        BadValue,       ///< A field is not a valid integer
+        CrcMismatch     ///< Checksum does not match the payload
+    };
+
+    /**
+     * @struct Result
+     * @brief Status together with checksum details for diagnostics
+     */
+    struct Result {
+        Status status = Status::Unrecognized; ///< Decoding outcome
+        PlatformSample::Type type = PlatformSample::Type::Imu; ///< Detected frame type
+        uint8_t receivedCrc = 0;              ///< Checksum sent in the frame
+        uint8_t calculatedCrc = 0;            ///< Checksum computed over the payload
+    };
+
+    /**
+     * @brief Decodes one trimmed line
+     * @param line Line without the trailing newline or surrounding whitespace
+     * @param sample Receives type, IMU id and values when the status is Ok
+     * @return Decoding result
+     *
+     * @note The sample timestamp is left untouched.
+     */
+    static Result decode(std::string_view line, PlatformSample &sample);
+};
+
+#endif // FRAMEDECODER_H
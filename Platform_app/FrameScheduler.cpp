@@ -0,0 +1,46 @@
+#include "FrameScheduler.h"
+#include <QGuiApplication>
+#include <QScreen>
+#include <QtMath>
+
+// Konstruktor harmonogramu klatek
+FrameScheduler::FrameScheduler(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, &QTimer::timeout, this, &FrameScheduler::onTimeout);
+    setRate(0);
+}
+
+// Ustawienie czestotliwosci odswiezania (0 = czestotliwosc ekranu)
+void FrameScheduler::setRate(double hz)
+{
+    if (hz <= 0) {
+        const QScreen *screen = QGuiApplication::primaryScreen();
+        hz = (screen && screen->refreshRate() > 1.0) ? screen->refreshRate() : 60.0;
+    }
+
+    m_rate = hz;
+    m_timer.setInterval(qMax(1, qRound(1000.0 / hz)));
+}
+
+// Zgloszenie nowych danych do wyswietlenia
+void FrameScheduler::requestFrame()
+{
+    m_pending = true;
+    if (!m_timer.isActive())
+        m_timer.start();
+}
+
+// Takt zegara klatek
+void FrameScheduler::onTimeout()
+{
+    if (!m_pending) {
+        // Brak nowych danych - zegar stoi do nastepnego zgloszenia
+        m_timer.stop();
+        return;
+    }
+
+    m_pending = false;
+    emit frame();
+}
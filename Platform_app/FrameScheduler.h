@@ -0,0 +1,77 @@
+/**
+ * @file    FrameScheduler.h
+ * @brief   Display-rate pacing of GUI updates
+ *
+ * @details Decouples widget updates from the incoming sample rate. Producers
+ *          only mark that new data is pending; the scheduler emits one
+ *          frame() signal per display refresh while data keeps arriving and
+ *          goes idle when nothing changes.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+
+/**
+ * @class FrameScheduler
+ * @brief Emits at most one frame per refresh interval while data is pending
+ *
+ * @details The default rate follows the refresh rate of the primary screen.
+ *          A fixed rate can be configured instead (e.g. to save CPU on
+ *          small machines or to match a high refresh monitor).
+ */
+class FrameScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the scheduler
+     * @param parent Parent object (default: nullptr)
+     */
+    explicit FrameScheduler(QObject *parent = nullptr);
+
+    /**
+     * @brief Sets the frame rate
+     * @param hz Frames per second; 0 selects the primary screen refresh rate
+     */
+    void setRate(double hz);
+
+    /**
+     * @brief Effective frame rate in frames per second
+     */
+    double rate() const { return m_rate; }
+
+    /**
+     * @brief Marks that new data is waiting to be shown
+     *
+     * @details Cheap enough to call for every sample; the actual widget
+     *          update happens on the next frame() signal.
+     */
+    void requestFrame();
+
+signals:
+    /**
+     * @brief Time to push pending state to the widgets
+     */
+    void frame();
+
+private slots:
+    /**
+     * @brief Timer tick - emits frame() or stops when idle
+     */
+    void onTimeout();
+
+private:
+    QTimer m_timer;          ///< Frame clock
+    double m_rate = 60.0;    ///< Effective frame rate (Hz)
+    bool m_pending = false;  ///< Data arrived since the last frame
+};
+
+#endif // FRAMESCHEDULER_H
@@ -0,0 +1,261 @@
+/**
+ * @file    FrameSchema.h
+ * @brief   Compile-time description of the ASCII frame types
+ *
+ * @details Every text frame is declared once as a descriptor type:
+ *          - the line prefix and the PlatformSample::Type it produces
+ *          - the ordered list of comma separated fields; each field states
+ *            where it is stored and whether it is covered by the CRC-8
+ *
+ *          FrameDecoder, formatFrame() and dispatchSample() are generated
+ *          from these descriptors by template expansion: the prefix checks,
+ *          the field loop and the CRC updates are unrolled per frame type,
+ *          with no virtual calls, tables of parsers or runtime string
+ *          switching. Frames are tried in the order of AsciiFrames, so a
+ *          type added at the end costs nothing for the frames listed before
+ *          it.
+ *
+ * Adding a frame type (e.g. a temperature reading):
+ * @code
+ * // PlatformSample.h: new enum value
+ * enum class Type : uint8_t { Imu, Servo, Temperature };
+ *
+ * // FrameSchema.h: descriptor and frame set
+ * struct TemperatureFrame {
+ *     static constexpr std::string_view kPrefix = "T:";
+ *     static constexpr PlatformSample::Type kType = PlatformSample::Type::Temperature;
+ *     using Fields = FieldList<ImuIdField, ValueField>;
+ * };
+ * using AsciiFrames = FrameSet<ImuFrame, ServoFrame, TemperatureFrame>;
+ * @endcode
+ *
+ *          The text decoder and formatSample() follow automatically. The
+ *          binary protocol needs its own record type in BinaryProtocol, and
+ *          every dispatchSample() call over AsciiFrames (MainWindow) stops
+ *          compiling until a handler for the new frame is added.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef FRAMESCHEMA_H
+#define FRAMESCHEMA_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "Crc8.h"
+#include "PlatformSample.h"
+
+/**
+ * @enum FieldTarget
+ * @brief Member of PlatformSample a field is stored in
+ */
+enum class FieldTarget {
+    ImuId,  ///< PlatformSample::imuId, full int range
+    Value   ///< Next entry of PlatformSample::values, truncated to 16 bits
+};
+
+/**
+ * @struct Field
+ * @brief Descriptor of one comma separated field
+ * @tparam Target Destination of the value
+ * @tparam InCrc true if the field is fed into the frame CRC (as int16)
+ */
+template <FieldTarget Target, bool InCrc>
+struct Field {
+    static constexpr FieldTarget kTarget = Target;  ///< Destination
+    static constexpr bool kInCrc = InCrc;           ///< Covered by the CRC
+};
+
+using ImuIdField = Field<FieldTarget::ImuId, false>;    ///< Sensor id, sent in clear
+using ValueField = Field<FieldTarget::Value, true>;     ///< Raw 16-bit reading
+
+/**
+ * @struct FieldList
+ * @brief Ordered fields of a frame
+ */
+template <typename... Fields>
+struct FieldList {
+    static constexpr std::size_t kCount = sizeof...(Fields);   ///< Number of fields
+
+    /**
+     * @brief Descriptor of field @p I
+     */
+    template <std::size_t I>
+    using At = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    /**
+     * @brief Index in PlatformSample::values of field @p I (Value fields)
+     */
+    template <std::size_t I>
+    static constexpr std::size_t valueIndex()
+    {
+        constexpr FieldTarget targets[] = { Fields::kTarget... };
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < I; ++i)
+            index += (targets[i] == FieldTarget::Value) ? 1 : 0;
+        return index;
+    }
+
+    static constexpr std::size_t kValueCount = valueIndex<kCount>();   ///< Value fields
+};
+
+/**
+ * @struct FrameSet
+ * @brief Frame types accepted on the wire, in matching order
+ */
+template <typename... Frames>
+struct FrameSet {
+    static constexpr std::size_t kCount = sizeof...(Frames);   ///< Number of frame types
+
+    static_assert(((Frames::Fields::kValueCount <= 6) && ...), "PlatformSample holds at most six values");
+};
+
+/**
+ * @struct ImuFrame
+ * @brief "IMU:<id>,<ax>,<ay>,<az>,<gx>,<gy>,<gz>*<crc>"
+ */
+struct ImuFrame {
+    static constexpr std::string_view kPrefix = "IMU:";    ///< Start of the line
+    static constexpr PlatformSample::Type kType = PlatformSample::Type::Imu;    ///< Sample produced
+    using Fields = FieldList<ImuIdField, ValueField, ValueField, ValueField, ValueField, ValueField, ValueField>;
+};
+
+/**
+ * @struct ServoFrame
+ * @brief "S:<a1>,<a2>,<a3>,<a4>,<a5>,<a6>*<crc>"
+ */
+struct ServoFrame {
+    static constexpr std::string_view kPrefix = "S:";      ///< Start of the line
+    static constexpr PlatformSample::Type kType = PlatformSample::Type::Servo;  ///< Sample produced
+    using Fields = FieldList<ValueField, ValueField, ValueField, ValueField, ValueField, ValueField>;
+};
+
+using AsciiFrames = FrameSet<ImuFrame, ServoFrame>;    ///< Frames decoded by FrameDecoder, most frequent first
+
+namespace detail {
+
+// Wartosc pola wedlug opisu (pola wartosci obciete do 16 bitow jak przy odbiorze)
+template <typename Frame, std::size_t I>
+constexpr int32_t fieldValue(const PlatformSample &sample)
+{
+    using FieldType = typename Frame::Fields::template At<I>;
+    if constexpr (FieldType::kTarget == FieldTarget::ImuId)
+        return sample.imuId;
+    else
+        return sample.values[Frame::Fields::template valueIndex<I>()];
+}
+
+template <typename Frame, std::size_t... I>
+constexpr uint8_t crcFields(const PlatformSample &sample, std::index_sequence<I...>)
+{
+    uint8_t crc = kCrc8Init;
+    ((crc = Frame::Fields::template At<I>::kInCrc
+                ? crc8UpdateInt16(crc, static_cast<int16_t>(fieldValue<Frame, I>(sample)))
+                : crc), ...);
+    return crc;
+}
+
+// Zapis jednego pola ramki (bez separatora)
+template <typename Frame, std::size_t I>
+char *formatField(const PlatformSample &sample, char *p, char *end)
+{
+    if (I > 0 && p != end) *p++ = ',';
+
+    const std::to_chars_result written = std::to_chars(p, end, fieldValue<Frame, I>(sample));
+    return written.ec == std::errc() ? written.ptr : end;
+}
+
+template <typename Frame, std::size_t... I>
+char *formatFields(const PlatformSample &sample, char *p, char *end, std::index_sequence<I...>)
+{
+    ((p = formatField<Frame, I>(sample, p, end)), ...);
+    return p;
+}
+
+} // namespace detail
+
+/**
+ * @brief CRC-8 of a sample as sent in a frame of type @p Frame
+ */
+template <typename Frame>
+constexpr uint8_t frameCrc(const PlatformSample &sample)
+{
+    return detail::crcFields<Frame>(sample, std::make_index_sequence<Frame::Fields::kCount>());
+}
+
+/**
+ * @brief Writes a sample as a frame of type @p Frame
+ * @param sample Sample to send
+ * @param crc Checksum to append (normally frameCrc<Frame>(sample))
+ * @param out Destination buffer
+ * @param capacity Size of @p out
+ * @return Characters written (no line terminator), 0 if @p out is too small
+ */
+template <typename Frame>
+std::size_t formatFrame(const PlatformSample &sample, uint8_t crc, char *out, std::size_t capacity)
+{
+    static constexpr char kHex[] = "0123456789ABCDEF";
+    char *const end = out + capacity;
+    if (capacity < Frame::kPrefix.size() + 3) return 0;
+
+    char *p = out;
+    for (char c : Frame::kPrefix)
+        *p++ = c;
+    p = detail::formatFields<Frame>(sample, p, end, std::make_index_sequence<Frame::Fields::kCount>());
+    if (end - p < 3) return 0;
+
+    *p++ = '*';
+    *p++ = kHex[crc >> 4];
+    *p++ = kHex[crc & 0x0F];
+    return static_cast<std::size_t>(p - out);
+}
+
+/**
+ * @brief Writes a sample as the frame type matching its PlatformSample::Type
+ * @param frames Frame set to choose from (e.g. AsciiFrames())
+ * @param sample Sample to send
+ * @param crcXor Mask applied to the checksum (non-zero sends a corrupted frame)
+ * @param out Destination buffer
+ * @param capacity Size of @p out
+ * @return Characters written, 0 if no frame type matches or @p out is too small
+ */
+template <typename... Frames>
+std::size_t formatSample(FrameSet<Frames...> frames, const PlatformSample &sample, uint8_t crcXor,
+                         char *out, std::size_t capacity)
+{
+    (void)frames;
+    std::size_t written = 0;
+    ((sample.type == Frames::kType
+          ? (written = formatFrame<Frames>(sample, frameCrc<Frames>(sample) ^ crcXor, out, capacity), true)
+          : false) || ...);
+    return written;
+}
+
+/**
+ * @brief Calls the handler matching the frame type of a sample
+ * @param frames Frame set to dispatch over (e.g. AsciiFrames())
+ * @param sample Sample to hand over
+ * @param handlers One callable per frame type, in the order of @p frames,
+ *        each taking the sample
+ * @return false if no frame type of the set produces PlatformSample::type
+ *
+ * @details A frame set and a handler list of different length do not
+ *          compile, so consumers cannot silently treat a new frame type as
+ *          one of the old ones.
+ */
+template <typename... Frames, typename... Handlers>
+bool dispatchSample(FrameSet<Frames...> frames, const PlatformSample &sample, Handlers &&...handlers)
+{
+    static_assert(sizeof...(Frames) == sizeof...(Handlers), "dispatchSample() needs one handler per frame type");
+    (void)frames;
+    return ((sample.type == Frames::kType ? (handlers(sample), true) : false) || ...);
+}
+
+#endif // FRAMESCHEMA_H
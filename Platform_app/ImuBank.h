@@ -0,0 +1,265 @@
+/**
+ * @file    ImuBank.h
+ * @brief   State of all connected IMUs stored as structure of arrays
+ *
+ * @details Replaces per-sensor member variables:
+ *          - IMU ids are mapped to dense slots through a lookup table, so
+ *            dispatching a sample is O(1) for any number of sensors
+ *          - Scaled values are kept per channel in contiguous arrays
+ *          - Slots touched since the last frame are tracked in a list,
+ *            so a frame costs O(changed IMUs) instead of O(all IMUs)
+ *          - Every sample updates the orientation filter of its IMU
+ *          - Raw values are scaled by the conversion kernel of the IMU range
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef IMUBANK_H
+#define IMUBANK_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ImuConversion.h"
+#include "MadgwickFilter.h"
+#include "PlatformSample.h"
+
+/**
+ * @class ImuBank
+ * @brief Latest scaled readings of every IMU, indexed by slot
+ *
+ * @details Slots are assigned in order of first appearance and never
+ *          reused. Accelerations are stored in m/s², angular rates in rad/s.
+ *
+ * Samples of one serial batch share their arrival timestamp, so the
+ * filter time step is the average sample period measured between batches
+ * rather than the difference of two timestamps.
+ */
+class ImuBank
+{
+public:
+    /**
+     * @enum Channel
+     * @brief Stored quantities, in frame field order
+     */
+    enum Channel { AccelX, AccelY, AccelZ, GyroX, GyroY, GyroZ, ChannelCount };
+
+    static constexpr int32_t kMaxId = 255;  ///< Largest accepted IMU id (binary protocol limit)
+    static constexpr int kMaxImus = 16;     ///< Upper bound on simultaneously tracked IMUs
+
+    ImuBank()
+    {
+        m_slotOfId.fill(-1);
+        m_converterOfId.fill(imuConverter(DefaultImuProfile::accelRange, DefaultImuProfile::gyroRange));
+    }
+
+    /**
+     * @brief Slot of an IMU id
+     * @return Slot index, or -1 if the id has not been seen
+     */
+    int slotOf(int32_t id) const { return (id >= 0 && id <= kMaxId) ? m_slotOfId[id] : -1; }
+
+    /**
+     * @brief Allocates a slot for a new IMU id
+     * @param id IMU identifier from the frame
+     * @return New slot index, or -1 if the id is out of range or all slots are used
+     */
+    int add(int32_t id)
+    {
+        if (id < 0 || id > kMaxId || count() >= kMaxImus) return -1;
+        if (m_slotOfId[id] >= 0) return m_slotOfId[id];
+
+        const int slot = count();
+        m_slotOfId[id] = slot;
+        m_ids.push_back(id);
+        for (std::vector<float> &channel : m_values)
+            channel.push_back(0.0f);
+        m_valid.push_back(0);
+        m_dirty.push_back(0);
+        m_pendingNs.push_back(0);
+        m_filters.emplace_back(m_beta);
+        m_filters.back().setAccelGate(kStandardGravity, kAccelGate);
+        m_batchNs.push_back(0);
+        m_batchSamples.push_back(0);
+        m_period.push_back(0.0f);
+        return slot;
+    }
+
+    /**
+     * @brief Stores a sample in its slot and marks the slot as changed
+     * @param slot Slot returned by slotOf() or add()
+     * @param sample IMU sample with raw LSB values
+     * @param scaled Values already converted with converter() of the IMU
+     *        (e.g. a whole replay chunk at once), nullptr to convert here
+     */
+    void store(int slot, const PlatformSample &sample, const float *scaled = nullptr)
+    {
+        float converted[ChannelCount];
+        if (!scaled) {
+            m_converterOfId[m_ids[slot]](sample.values, ChannelCount, converted, 1);
+            scaled = converted;
+        }
+        for (int c = 0; c < ChannelCount; ++c)
+            m_values[c][slot] = scaled[c];
+        m_valid[slot] = 1;
+
+        // Fuzja przyspieszen i predkosci katowych przy kazdej probce
+        const float dt = updatePeriod(slot, sample.timestampNs);
+        if (dt > 0.0f) {
+            m_filters[slot].update(m_values[GyroX][slot], m_values[GyroY][slot], m_values[GyroZ][slot],
+                                   m_values[AccelX][slot], m_values[AccelY][slot], m_values[AccelZ][slot], dt);
+        }
+
+        if (!m_dirty[slot]) {
+            m_dirty[slot] = 1;
+            m_pendingNs[slot] = sample.timestampNs;
+            m_dirtySlots.push_back(slot);
+        }
+    }
+
+    /**
+     * @brief Number of tracked IMUs
+     */
+    int count() const { return static_cast<int>(m_ids.size()); }
+
+    /**
+     * @brief IMU id of a slot
+     */
+    int32_t id(int slot) const { return m_ids[slot]; }
+
+    /**
+     * @brief True once the slot received a sample
+     */
+    bool valid(int slot) const { return m_valid[slot] != 0; }
+
+    /**
+     * @brief Scaled value of one channel
+     */
+    float value(Channel channel, int slot) const { return m_values[channel][slot]; }
+
+    /**
+     * @brief All values of a slot in Channel order
+     * @param slot Slot index
+     * @param out Receives ChannelCount values
+     */
+    void values(int slot, float *out) const
+    {
+        for (int c = 0; c < ChannelCount; ++c)
+            out[c] = m_values[c][slot];
+    }
+
+    /**
+     * @brief Selects the sensor range of an IMU
+     * @param id IMU identifier, seen or not yet seen
+     * @param accel Accelerometer full scale
+     * @param gyro Gyroscope full scale
+     * @return false if the id is out of range
+     *
+     * @details Applies to samples stored after the call. IMUs without a
+     *          selected range use DefaultImuProfile.
+     */
+    bool setRange(int32_t id, AccelRange accel, GyroRange gyro)
+    {
+        if (id < 0 || id > kMaxId) return false;
+        m_converterOfId[id] = imuConverter(accel, gyro);
+        return true;
+    }
+
+    /**
+     * @brief Conversion kernel of an IMU (see setRange())
+     * @param id IMU identifier; out of range ids get the default kernel
+     */
+    ImuConverter converter(int32_t id) const
+    {
+        return (id >= 0 && id <= kMaxId) ? m_converterOfId[id]
+                                         : imuConverter(DefaultImuProfile::accelRange, DefaultImuProfile::gyroRange);
+    }
+
+    /**
+     * @brief Orientation estimate of a slot (sensor to earth frame)
+     */
+    const MadgwickFilter &orientation(int slot) const { return m_filters[slot]; }
+
+    /**
+     * @brief Measured sample period of a slot (s), 0 until known
+     */
+    float samplePeriod(int slot) const { return m_period[slot]; }
+
+    /**
+     * @brief Sets the accelerometer correction gain of all orientation filters
+     * @param beta Gain in rad/s (see MadgwickFilter::setBeta())
+     */
+    void setFusionGain(float beta)
+    {
+        m_beta = beta;
+        for (MadgwickFilter &filter : m_filters)
+            filter.setBeta(beta);
+    }
+
+    /**
+     * @brief Slots changed since the last clearDirty(), in order of change
+     */
+    const std::vector<int> &dirtySlots() const { return m_dirtySlots; }
+
+    /**
+     * @brief Arrival time of the first unshown sample of a changed slot
+     */
+    int64_t pendingNs(int slot) const { return m_pendingNs[slot]; }
+
+    /**
+     * @brief Marks all slots as shown
+     */
+    void clearDirty()
+    {
+        for (int slot : m_dirtySlots)
+            m_dirty[slot] = 0;
+        m_dirtySlots.clear();
+    }
+
+private:
+    static constexpr float kAccelGate = 0.3f;       ///< Accepted deviation of |a| from 1 g
+    static constexpr float kMinPeriod = 20e-6f;     ///< Shortest plausible sample period (s)
+    static constexpr float kMaxPeriod = 0.1f;       ///< Longest plausible sample period (s)
+
+    /**
+     * @brief Updates and returns the sample period estimate of a slot
+     * @param slot Slot receiving a sample
+     * @param timestampNs Arrival time of the sample
+     * @return Period in seconds, 0 until the first two batches were seen
+     */
+    float updatePeriod(int slot, int64_t timestampNs)
+    {
+        if (timestampNs != m_batchNs[slot]) {
+            const float measured = m_batchSamples[slot] > 0
+                                       ? (timestampNs - m_batchNs[slot]) * 1e-9f / m_batchSamples[slot] : 0.0f;
+
+            // Przerwy w strumieniu nie zmieniaja oszacowania
+            if (m_batchNs[slot] != 0 && measured >= kMinPeriod && measured <= kMaxPeriod) {
+                m_period[slot] = (m_period[slot] > 0.0f) ? 0.9f * m_period[slot] + 0.1f * measured : measured;
+            }
+            m_batchNs[slot] = timestampNs;
+            m_batchSamples[slot] = 0;
+        }
+        ++m_batchSamples[slot];
+        return m_period[slot];
+    }
+
+    float m_beta = 0.05f;                                       ///< Filter gain for new slots
+    std::array<int8_t, kMaxId + 1> m_slotOfId;                 ///< IMU id to slot, -1 if unknown
+    std::array<ImuConverter, kMaxId + 1> m_converterOfId;       ///< Raw to SI kernel per IMU id
+    std::vector<int32_t> m_ids;                                 ///< Slot to IMU id
+    std::array<std::vector<float>, ChannelCount> m_values;      ///< Scaled values per channel
+    std::vector<uint8_t> m_valid;                               ///< Slot received a sample
+    std::vector<uint8_t> m_dirty;                               ///< Slot changed since the last frame
+    std::vector<int64_t> m_pendingNs;                           ///< First unshown arrival time per slot
+    std::vector<int> m_dirtySlots;                              ///< Changed slots
+    std::vector<MadgwickFilter> m_filters;                      ///< Orientation per slot
+    std::vector<int64_t> m_batchNs;                             ///< Arrival time of the current batch
+    std::vector<int> m_batchSamples;                            ///< Samples received in the current batch
+    std::vector<float> m_period;                                ///< Smoothed sample period (s)
+};
+
+#endif // IMUBANK_H
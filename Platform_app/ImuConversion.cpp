@@ -0,0 +1,222 @@
+#include "ImuConversion.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define IMU_CONVERSION_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define IMU_CONVERSION_SSE2 1
+#endif
+
+namespace {
+
+// Wersja skalarna (koncowki blokow i platformy bez SIMD)
+inline void convertScalar(const int16_t *raw, std::size_t stride, float *out, std::size_t samples,
+                          float accel, float gyro)
+{
+    for (std::size_t i = 0; i < samples; ++i, raw += stride, out += 6) {
+        out[0] = raw[0] * accel;
+        out[1] = raw[1] * accel;
+        out[2] = raw[2] * accel;
+        out[3] = raw[3] * gyro;
+        out[4] = raw[4] * gyro;
+        out[5] = raw[5] * gyro;
+    }
+}
+
+#if IMU_CONVERSION_SSE2
+
+// Rozszerzenie znaku czterech int16 do float
+inline __m128 lowToFloat(__m128i v)
+{
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+}
+
+inline __m128 highToFloat(__m128i v)
+{
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+}
+
+// Probki spakowane: 2 probki (12 wartosci) na iteracje
+inline std::size_t convertPackedSse2(const int16_t *raw, float *out, std::size_t samples,
+                                     float accel, float gyro)
+{
+    // Wzorzec skal powtarza sie co 12 wartosci
+    const __m128 s0 = _mm_setr_ps(accel, accel, accel, gyro);
+    const __m128 s1 = _mm_setr_ps(gyro, gyro, accel, accel);
+    const __m128 s2 = _mm_setr_ps(accel, gyro, gyro, gyro);
+
+    std::size_t i = 0;
+    for (; i + 2 <= samples; i += 2, raw += 12, out += 12) {
+        const __m128i v01 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw));
+        const __m128i v2 = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(raw + 8));
+        _mm_storeu_ps(out, _mm_mul_ps(lowToFloat(v01), s0));
+        _mm_storeu_ps(out + 4, _mm_mul_ps(highToFloat(v01), s1));
+        _mm_storeu_ps(out + 8, _mm_mul_ps(lowToFloat(v2), s2));
+    }
+    return i;
+}
+
+// Probki z odstepem (np. PlatformSample) - jedna probka na iteracje
+inline void convertStridedSse2(const int16_t *raw, std::size_t stride, float *out, std::size_t samples,
+                               float accel, float gyro)
+{
+    const __m128 s0 = _mm_setr_ps(accel, accel, accel, gyro);
+    const __m128 s1 = _mm_set1_ps(gyro);
+
+    for (std::size_t i = 0; i < samples; ++i, raw += stride, out += 6) {
+        // Dokladnie 12 bajtow - bez czytania poza rekord
+        int32_t tail;
+        std::memcpy(&tail, raw + 4, sizeof(tail));
+        const __m128i head = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(raw));
+        const __m128 rest = _mm_mul_ps(lowToFloat(_mm_cvtsi32_si128(tail)), s1);
+
+        _mm_storeu_ps(out, _mm_mul_ps(lowToFloat(head), s0));
+        _mm_storel_pi(reinterpret_cast<__m64 *>(out + 4), rest);
+    }
+}
+
+#endif
+
+#if IMU_CONVERSION_AVX2
+
+// Probki spakowane: 4 probki (24 wartosci) na iteracje
+inline std::size_t convertPackedAvx2(const int16_t *raw, float *out, std::size_t samples,
+                                     float accel, float gyro)
+{
+    // Wzorzec skal powtarza sie co 24 wartosci
+    const __m256 s0 = _mm256_setr_ps(accel, accel, accel, gyro, gyro, gyro, accel, accel);
+    const __m256 s1 = _mm256_setr_ps(accel, gyro, gyro, gyro, accel, accel, accel, gyro);
+    const __m256 s2 = _mm256_setr_ps(gyro, gyro, accel, accel, accel, gyro, gyro, gyro);
+
+    std::size_t i = 0;
+    for (; i + 4 <= samples; i += 4, raw += 24, out += 24) {
+        const __m256 f0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw))));
+        const __m256 f1 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw + 8))));
+        const __m256 f2 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw + 16))));
+        _mm256_storeu_ps(out, _mm256_mul_ps(f0, s0));
+        _mm256_storeu_ps(out + 8, _mm256_mul_ps(f1, s1));
+        _mm256_storeu_ps(out + 16, _mm256_mul_ps(f2, s2));
+    }
+    return i;
+}
+
+#endif
+
+// Wybor wariantu dla ukladu danych
+inline void convert(const int16_t *raw, std::size_t stride, float *out, std::size_t samples,
+                    float accel, float gyro)
+{
+    std::size_t done = 0;
+    if (stride == 6) {
+#if IMU_CONVERSION_AVX2
+        done = convertPackedAvx2(raw, out, samples, accel, gyro);
+#elif IMU_CONVERSION_SSE2
+        done = convertPackedSse2(raw, out, samples, accel, gyro);
+#endif
+        convertScalar(raw + done * 6, 6, out + done * 6, samples - done, accel, gyro);
+        return;
+    }
+
+#if IMU_CONVERSION_SSE2
+    convertStridedSse2(raw, stride, out, samples, accel, gyro);
+#else
+    convertScalar(raw, stride, out, samples, accel, gyro);
+#endif
+}
+
+template <AccelRange Accel>
+ImuConverter converterFor(GyroRange gyro)
+{
+    switch (gyro) {
+    case GyroRange::Dps250:  return &convertImuBlock<ImuProfile<Accel, GyroRange::Dps250>>;
+    case GyroRange::Dps500:  return &convertImuBlock<ImuProfile<Accel, GyroRange::Dps500>>;
+    case GyroRange::Dps1000: return &convertImuBlock<ImuProfile<Accel, GyroRange::Dps1000>>;
+    default:                 return &convertImuBlock<ImuProfile<Accel, GyroRange::Dps2000>>;
+    }
+}
+
+} // namespace
+
+// Kernel profilu - skale jako stale czasu kompilacji
+template <class Profile>
+void convertImuBlock(const int16_t *raw, std::size_t stride, float *out, std::size_t samples)
+{
+    convert(raw, stride, out, samples, Profile::accelScale, Profile::gyroScale);
+}
+
+// Kernel dla zakresu wybranego w czasie dzialania
+ImuConverter imuConverter(AccelRange accel, GyroRange gyro)
+{
+    switch (accel) {
+    case AccelRange::G2:  return converterFor<AccelRange::G2>(gyro);
+    case AccelRange::G4:  return converterFor<AccelRange::G4>(gyro);
+    case AccelRange::G8:  return converterFor<AccelRange::G8>(gyro);
+    default:              return converterFor<AccelRange::G16>(gyro);
+    }
+}
+
+// Zakres akcelerometru z pelnej skali w g
+bool accelRangeFromG(int g, AccelRange &range)
+{
+    switch (g) {
+    case 2:  range = AccelRange::G2;  return true;
+    case 4:  range = AccelRange::G4;  return true;
+    case 8:  range = AccelRange::G8;  return true;
+    case 16: range = AccelRange::G16; return true;
+    default: return false;
+    }
+}
+
+// Zakres zyroskopu z pelnej skali w stopniach na sekunde
+bool gyroRangeFromDps(int dps, GyroRange &range)
+{
+    switch (dps) {
+    case 250:  range = GyroRange::Dps250;  return true;
+    case 500:  range = GyroRange::Dps500;  return true;
+    case 1000: range = GyroRange::Dps1000; return true;
+    case 2000: range = GyroRange::Dps2000; return true;
+    default:   return false;
+    }
+}
+
+const char *imuConversionIsa()
+{
+#if IMU_CONVERSION_AVX2
+    return "avx2";
+#elif IMU_CONVERSION_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+// Jawne instancje wszystkich profili
+#define IMU_PROFILE_INSTANCE(accel, gyro) \
+    template void convertImuBlock<ImuProfile<AccelRange::accel, GyroRange::gyro>>( \
+        const int16_t *, std::size_t, float *, std::size_t);
+
+IMU_PROFILE_INSTANCE(G2, Dps250)
+IMU_PROFILE_INSTANCE(G2, Dps500)
+IMU_PROFILE_INSTANCE(G2, Dps1000)
+IMU_PROFILE_INSTANCE(G2, Dps2000)
+IMU_PROFILE_INSTANCE(G4, Dps250)
+IMU_PROFILE_INSTANCE(G4, Dps500)
+IMU_PROFILE_INSTANCE(G4, Dps1000)
+IMU_PROFILE_INSTANCE(G4, Dps2000)
+IMU_PROFILE_INSTANCE(G8, Dps250)
+IMU_PROFILE_INSTANCE(G8, Dps500)
+IMU_PROFILE_INSTANCE(G8, Dps1000)
+IMU_PROFILE_INSTANCE(G8, Dps2000)
+IMU_PROFILE_INSTANCE(G16, Dps250)
+IMU_PROFILE_INSTANCE(G16, Dps500)
+IMU_PROFILE_INSTANCE(G16, Dps1000)
+IMU_PROFILE_INSTANCE(G16, Dps2000)
+
+#undef IMU_PROFILE_INSTANCE
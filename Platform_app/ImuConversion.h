@@ -0,0 +1,115 @@
+/**
+ * @file    ImuConversion.h
+ * @brief   Batch conversion of raw IMU readings to SI units
+ *
+ * @details Replaces the per-value scaling constants spread over the GUI:
+ *          - Sensor ranges are compile-time profiles (±2…16 g, 250…2000 dps)
+ *          - One kernel instance per profile, so the scales are constants
+ *          - AVX2 or SSE2 when the build enables them, scalar otherwise
+ *          - Input may be packed or strided (PlatformSample, SessionRecord)
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef IMUCONVERSION_H
+#define IMUCONVERSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr float kStandardGravity = 9.80665f;    ///< 1 g in m/s²
+
+/**
+ * @enum AccelRange
+ * @brief Accelerometer full scale
+ */
+enum class AccelRange { G2, G4, G8, G16 };
+
+/**
+ * @enum GyroRange
+ * @brief Gyroscope full scale
+ */
+enum class GyroRange { Dps250, Dps500, Dps1000, Dps2000 };
+
+/**
+ * @brief Accelerometer sensitivity of a range (LSB per g)
+ */
+constexpr float accelLsbPerG(AccelRange range)
+{
+    return range == AccelRange::G2 ? 16384.0f
+         : range == AccelRange::G4 ? 8192.0f
+         : range == AccelRange::G8 ? 4096.0f : 2048.0f;
+}
+
+/**
+ * @brief Gyroscope sensitivity of a range (LSB per °/s)
+ */
+constexpr float gyroLsbPerDps(GyroRange range)
+{
+    return range == GyroRange::Dps250 ? 131.0f
+         : range == GyroRange::Dps500 ? 65.5f
+         : range == GyroRange::Dps1000 ? 32.8f : 16.4f;
+}
+
+/**
+ * @brief Accelerometer range from its full scale
+ * @param g Full scale in g (2, 4, 8 or 16)
+ * @param range Receives the range
+ * @return false for an unsupported full scale
+ */
+bool accelRangeFromG(int g, AccelRange &range);
+
+/**
+ * @brief Gyroscope range from its full scale
+ * @param dps Full scale in °/s (250, 500, 1000 or 2000)
+ * @param range Receives the range
+ * @return false for an unsupported full scale
+ */
+bool gyroRangeFromDps(int dps, GyroRange &range);
+
+/**
+ * @struct ImuProfile
+ * @brief Compile-time sensor range
+ * @tparam Accel Accelerometer full scale
+ * @tparam Gyro Gyroscope full scale
+ */
+template <AccelRange Accel, GyroRange Gyro>
+struct ImuProfile {
+    static constexpr AccelRange accelRange = Accel;
+    static constexpr GyroRange gyroRange = Gyro;
+    static constexpr float accelScale = kStandardGravity / accelLsbPerG(Accel);            ///< LSB to m/s²
+    static constexpr float gyroScale = 3.14159265f / (gyroLsbPerDps(Gyro) * 180.0f);       ///< LSB to rad/s
+};
+
+/// Range of the IMUs on the platform
+using DefaultImuProfile = ImuProfile<AccelRange::G2, GyroRange::Dps500>;
+
+/**
+ * @brief Converts raw samples of one profile
+ * @tparam Profile ImuProfile specialization
+ * @param raw First raw value (ax, ay, az, gx, gy, gz per sample)
+ * @param stride Distance between samples in int16_t units (6 if packed)
+ * @param out Receives 6 floats per sample: m/s², then rad/s
+ * @param samples Number of samples
+ *
+ * @details Defined in ImuConversion.cpp for every AccelRange/GyroRange pair.
+ */
+template <class Profile>
+void convertImuBlock(const int16_t *raw, std::size_t stride, float *out, std::size_t samples);
+
+/// Kernel of one profile
+using ImuConverter = void (*)(const int16_t *raw, std::size_t stride, float *out, std::size_t samples);
+
+/**
+ * @brief Kernel for a range chosen at run time (e.g. per IMU)
+ */
+ImuConverter imuConverter(AccelRange accel, GyroRange gyro);
+
+/**
+ * @brief Name of the instruction set used by the kernels ("avx2", "sse2" or "scalar")
+ */
+const char *imuConversionIsa();
+
+#endif // IMUCONVERSION_H
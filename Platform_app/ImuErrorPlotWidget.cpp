@@ -1,4 +1,7 @@
 #include "ImuErrorPlotWidget.h"
+#include "PlatformSample.h"
+#include "PlotDecimation.h"
+#include "LatencyProbe.h"
 #include <QVBoxLayout>
 
 /**
@@ -11,10 +14,8 @@
  * @param parent Wskaznik na widget nadrzedny, albo nullptr.
  */
 ImuErrorPlotWidget::ImuErrorPlotWidget(QWidget *parent)
-    : QWidget(parent), sampleIndex(0)
+    : QWidget(parent), history(8192)
 {
-    timer.start();
-
     // Inicjalizacja serii danych dla bledu akcelerometru
     accelX = new QLineSeries(); accelX->setName(tr("ΔAccel X"));
     accelY = new QLineSeries(); accelY->setName(tr("ΔAccel Y"));
@@ -91,6 +92,10 @@ ImuErrorPlotWidget::ImuErrorPlotWidget(QWidget *parent)
 
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
 
+    // Zmiana rozmiaru wykresu zmienia liczbe rysowanych punktow
+    connect(accelChart, &QChart::plotAreaChanged, this, &ImuErrorPlotWidget::refreshSeries);
+    connect(gyroChart, &QChart::plotAreaChanged, this, &ImuErrorPlotWidget::refreshSeries);
+
     // Uklad poziomy
     QHBoxLayout *layout = new QHBoxLayout(this);
     layout->addWidget(accelChartView);
@@ -113,32 +118,62 @@ ImuErrorPlotWidget::ImuErrorPlotWidget(QWidget *parent)
  */
 void ImuErrorPlotWidget::addErrorSample(float dax, float day, float daz, float dgx, float dgy, float dgz)
 {
-    qreal timeSec = timer.elapsed() / 1000.0;
+    const Sample sample = { monotonicNowNs(), { dax, day, daz }, { dgx, dgy, dgz } };
+    addErrorSamples(QVector<Sample>{ sample });
+}
+
+/**
+ * @brief Dodaje paczke prob bledu IMU do wykresow.
+ *
+ * Probki trafiaja do bufora cyklicznego, z ktorego usuwane sa punkty spoza
+ * okna czasowego. Serie sa odswiezane raz na paczke (jedno replace()).
+ *
+ * @param samples Probki w kolejnosci chronologicznej.
+ */
+void ImuErrorPlotWidget::addErrorSamples(const QVector<Sample> &samples)
+{
+    if (samples.isEmpty()) return;
+
+    if (epochNs < 0) epochNs = samples.first().timestampNs;
 
-    // Dodajemy nowe punkty danych do kazdej serii
-    accelX->append(timeSec, dax);
-    accelY->append(timeSec, day);
-    accelZ->append(timeSec, daz);
+    for (const Sample &sample : samples) {
+        const float values[6] = { sample.accel[0], sample.accel[1], sample.accel[2],
+                                  sample.gyro[0], sample.gyro[1], sample.gyro[2] };
+        history.push((sample.timestampNs - epochNs) * 1e-9, values);
+    }
+
+    // Usuniecie punktow spoza okna czasowego
+    history.dropBefore(history.lastTime() - window);
 
-    gyroX->append(timeSec, dgx);
-    gyroY->append(timeSec, dgy);
-    gyroZ->append(timeSec, dgz);
+    refreshSeries();
+}
 
-    // Szerokosc widocznego okna czasowego (w sekundach)
-    constexpr qreal windowWidth = 4.0;
+/**
+ * @brief Usuwa cala historie z wykresow.
+ */
+void ImuErrorPlotWidget::clear()
+{
+    history.clear();
+    epochNs = -1;
+    refreshSeries();
+}
 
-    qreal start = qMax(0.0, timeSec - windowWidth);
-    qreal end = timeSec;
+/**
+ * @brief Przepisuje zawartosc bufora do serii wykresow.
+ */
+void ImuErrorPlotWidget::refreshSeries()
+{
+    const qreal end = history.empty() ? 0.0 : history.lastTime();
+    const qreal start = qMax(0.0, end - window);
 
-    // Lambda do usuwania starych punktow z serii
-    auto pruneOldPoints = [start](QLineSeries* series) {
-        while (!series->pointsVector().isEmpty() && series->pointsVector().first().x() < start) {
-            series->remove(0);
-        }
-    };
+    // Liczba punktow ograniczona szerokoscia obszaru wykresu (min/max na kolumne pikseli)
+    const int accelColumns = qRound(accelChart->plotArea().width());
+    const int gyroColumns = qRound(gyroChart->plotArea().width());
 
-    for (QLineSeries* s : {accelX, accelY, accelZ, gyroX, gyroY, gyroZ}) {
-        pruneOldPoints(s);
+    QLineSeries *series[6] = { accelX, accelY, accelZ, gyroX, gyroY, gyroZ };
+    for (int c = 0; c < 6; ++c) {
+        decimateMinMax(history, c, start, end, c < 3 ? accelColumns : gyroColumns, points);
+        series[c]->replace(points);
     }
 
     // Aktualizacja zakresu osi X
@@ -146,6 +181,41 @@ void ImuErrorPlotWidget::addErrorSample(float dax, float day, float daz, float d
     gyroAxisX->setRange(start, end);
 }
 
+/**
+ * @brief Ustawia szerokosc widocznego okna czasowego.
+ *
+ * @param seconds Szerokosc okna w sekundach.
+ */
+void ImuErrorPlotWidget::setWindowWidth(qreal seconds)
+{
+    window = qMax<qreal>(0.1, seconds);
+    if (!history.empty()) {
+        history.dropBefore(history.lastTime() - window);
+        refreshSeries();
+    }
+}
+
+/**
+ * @brief Ustawia pojemnosc bufora historii (liczba probek na os).
+ *
+ * @param samples Liczba przechowywanych probek.
+ */
+void ImuErrorPlotWidget::setHistoryCapacity(int samples)
+{
+    history.setCapacity(static_cast<std::size_t>(qMax(1, samples)));
+    refreshSeries();
+}
+
+/**
+ * @brief Podlacza sonde opoznienia do rysowania wykresu przyspieszen.
+ *
+ * @param probe Sonda powiadamiana przy kazdym rysowaniu.
+ */
+void ImuErrorPlotWidget::setLatencyProbe(LatencyProbe *probe)
+{
+    accelChartView->viewport()->installEventFilter(probe);
+}
+
 void ImuErrorPlotWidget::retranslateUi()
 {
     accelX->setName(tr("ΔAccel X"));
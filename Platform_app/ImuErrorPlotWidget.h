@@ -21,7 +21,11 @@
 #include <QtCharts/QLineSeries>
 #include <QtCharts/QChart>
 #include <QtCharts/QValueAxis>
-#include <QElapsedTimer>
+#include <QVector>
+
+#include "SampleRing.h"
+
+class LatencyProbe;
 
 /**
  * @class ImuErrorPlotWidget
@@ -29,7 +33,8 @@
  *
  * @details Features include:
  *          - Separate charts for accelerometer and gyroscope errors
- *          - 200-sample rolling history
+ *          - Rolling time window backed by a fixed-capacity ring buffer
+ *          - Min/max downsampling to the plot width
  *          - Color-coded axes (X=red, Y=green, Z=blue)
  *          - Dynamic Y-axis scaling
  *          - Millisecond-accurate timing
@@ -77,6 +82,63 @@ public:
      */
     void addErrorSample(float dax, float day, float daz, float dgx, float dgy, float dgz);
 
+    /**
+     * @struct Sample
+     * @brief One timestamped IMU difference sample
+     */
+    struct Sample {
+        qint64 timestampNs;  ///< Host monotonic time of the sample (see monotonicNowNs())
+        float accel[3];      ///< Acceleration differences X, Y, Z (m/s²)
+        float gyro[3];       ///< Angular velocity differences X, Y, Z (rad/s)
+    };
+
+    /**
+     * @brief Adds a batch of error samples with a single chart update
+     * @param samples Samples in chronological order
+     *
+     * @details Intended to be called once per display frame with all
+     *          samples received since the previous frame. Samples go to the
+     *          ring buffer and each series is refreshed with one replace().
+     */
+    void addErrorSamples(const QVector<Sample> &samples);
+
+    /**
+     * @brief Discards the plotted history (e.g. when another IMU pair is selected)
+     */
+    void clear();
+
+    /**
+     * @brief Sets the width of the visible time window
+     * @param seconds Window width in seconds (default 4 s)
+     */
+    void setWindowWidth(qreal seconds);
+
+    /**
+     * @brief Width of the visible time window in seconds
+     */
+    qreal windowWidth() const { return window; }
+
+    /**
+     * @brief Sets the number of samples kept per axis
+     * @param samples Ring buffer capacity; bounds memory at high sample rates
+     *
+     * @details Discards the current history. When the capacity is reached
+     *          before the window is full, the oldest samples are dropped
+     *          and the plot shows a shorter span.
+     */
+    void setHistoryCapacity(int samples);
+
+    /**
+     * @brief Number of samples kept per axis
+     */
+    int historyCapacity() const { return static_cast<int>(history.capacity()); }
+
+    /**
+     * @brief Reports chart repaints to a latency probe
+     * @param probe Probe notified when the charts are painted
+     */
+    void setLatencyProbe(LatencyProbe *probe);
+
     /**
      * @brief Updates all user-visible strings in the UI to reflect the current language.
      *
@@ -87,8 +149,9 @@ public:
     void retranslateUi();
 
 private:
-    int sampleIndex;                  ///< Circular buffer index (0-maxSamples)
-    const int maxSamples = 200;       ///< Maximum stored samples per axis
+    SampleRing<6> history;            ///< Accel X/Y/Z and gyro X/Y/Z differences over time
+    qreal window = 4.0;               ///< Visible time window (s)
+    QVector<QPointF> points;          ///< Reused decimation buffer for replace()
 
     // Accelerometer error series
     QLineSeries *accelX;              ///< X-axis acceleration error (typically red)
@@ -114,7 +177,16 @@ private:
     QValueAxis *gyroAxisX;            ///< Gyroscope time/index axis
     QValueAxis *gyroAxisY;            ///< Gyroscope value axis (auto-scaled)
 
-    QElapsedTimer timer;              ///< High-resolution timer for sample timing
+    qint64 epochNs = -1;              ///< Timestamp mapped to t = 0 on the time axis
+
+    /**
+     * @brief Pushes the ring buffer contents to the series and axes
+     *
+     * @details Each series receives at most two points per pixel column of
+     *          its plot area (see decimateMinMax()), so the drawing cost
+     *          does not depend on the sample rate.
+     */
+    void refreshSeries();
 
     /**
      * @brief Initializes a chart with default settings
@@ -1,24 +1,32 @@
 #include "ImuGForce.h"
 #include <QPainter>
 #include <QtMath>
-#include <QElapsedTimer>
 
-// Globalny timer do pomiaru czasu od uruchomienia programu
-static QElapsedTimer globalTimer;
+namespace {
+
+constexpr qreal kSecondsPerNs = 1e-9;
+
+} // namespace
 
 // Konstruktor widgetu wyswietlajacego G-force
 ImuGForceWidget::ImuGForceWidget(QWidget *parent)
-    : QWidget(parent), accX(0.0f), accY(0.0f), maxG(3.0f), lastUpdateTime(0.0) {
-    if (!globalTimer.isValid())
-        globalTimer.start();  // Start timera, jesli jeszcze nie zostal uruchomiony
+    : QWidget(parent), accX(0.0f), accY(0.0f), maxG(3.0f), trace(1), lastUpdateTime(0.0), expectedRate(0.0) {
+    // Rozmiar poczatkowy - MainWindow dopasowuje go do zmierzonej czestotliwosci IMU
+    setExpectedSampleRate(1000.0);
 
     // Ustawienie polityki rozmiaru (automatyczne dopasowanie do dostepnej przestrzeni)
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
 }
 
-// Funkcja pomocnicza - zwraca czas w sekundach od uruchomienia programu
+// Funkcja pomocnicza - zwraca czas w sekundach (ta sama baza co znaczniki probek)
 qreal ImuGForceWidget::getElapsedSeconds() {
-    return globalTimer.elapsed() / 1000.0;
+    return monotonicNowNs() * kSecondsPerNs;
+}
+
+// Dodanie punktu do sladu (bez przerysowania)
+void ImuGForceWidget::appendTracePoint(float ax, float ay, qreal now) {
+    const float values[2] = { ax, ay };
+    trace.push(now, values);
 }
 
 // Ustawienie nowego przyspieszenia i aktualizacja wykresu
@@ -29,14 +37,37 @@ void ImuGForceWidget::setAcceleration(float ax, float ay) {
     qreal now = getElapsedSeconds();  // Aktualny czas
     lastUpdateTime = now;             // Zapamietanie czasu ostatniej aktualizacji
 
-    trace.append({ ax, ay, now });    // Dodanie punktu do listy sladow (trace)
+    appendTracePoint(ax, ay, now);    // Dodanie punktu do sladu (trace)
+    trace.dropBefore(now - traceSeconds);  // Usuniecie punktow starszych niz 2 sekundy
 
-    // Usuniecie punktow starszych niz 2 sekundy
-    while (!trace.isEmpty() && (now - trace.first().timestamp > 2.0)) {
-        trace.removeFirst();
+    update();  // Wymuszenie przerysowania widgetu
+}
+
+// Dodanie paczki probek (jedno przerysowanie na klatke)
+void ImuGForceWidget::addAccelerationSamples(const QVector<Sample> &samples) {
+    if (samples.isEmpty()) return;
+
+    // Kazdy punkt z wlasnym czasem nadejscia - wiek i wygaszanie liczone per probka
+    for (const Sample &sample : samples) {
+        appendTracePoint(static_cast<float>(sample.g.x()), static_cast<float>(sample.g.y()),
+                         sample.timestampNs * kSecondsPerNs);
     }
+    accX = static_cast<float>(samples.last().g.x());
+    accY = static_cast<float>(samples.last().g.y());
 
-    update();  // Wymuszenie przerysowania widgetu
+    lastUpdateTime = samples.last().timestampNs * kSecondsPerNs;
+    trace.dropBefore(lastUpdateTime - traceSeconds);  // Usuniecie punktow starszych niz 2 sekundy
+
+    update();
+}
+
+// Rozmiar bufora sladu dopasowany do czestotliwosci probek (z 25% zapasem)
+void ImuGForceWidget::setExpectedSampleRate(double hz) {
+    expectedRate = qMax(1.0, hz);
+    const double samples = expectedRate * traceSeconds * 1.25;
+    trace.setCapacity(static_cast<std::size_t>(qCeil(samples)));
+    polyline.reserve(static_cast<int>(trace.capacity()) + alphaBuckets);
+    update();
 }
 
 // Minimalny rozmiar widgetu
@@ -78,30 +109,7 @@ void ImuGForceWidget::paintEvent(QPaintEvent *) {
     painter.drawLine(QPointF(0, -radius), QPointF(0, radius));  // Oś Y
 
     // Rysowanie sladu G z ostatnich 2 sekund (blednosc zalezy od wieku punktu)
-    qreal now = lastUpdateTime;
-    if (trace.size() >= 2) {
-        for (int i = 1; i < trace.size(); ++i) {
-            const TracePoint &prev = trace[i - 1];
-            const TracePoint &curr = trace[i];
-
-            qreal age = now - curr.timestamp;
-            if (age > 2.0) continue;  // Pomijamy stare punkty
-
-            qreal alpha = 1.0 - (age / 2.0);  // Przezroczystosc w zaleznosci od wieku
-            QColor traceColor = Qt::blue;
-            traceColor.setAlphaF(alpha);
-
-            // Przeskalowanie wspolrzednych G do rozmiaru wykresu
-            float x1 = prev.ax / maxG * radius;
-            float y1 = -prev.ay / maxG * radius;
-            float x2 = curr.ax / maxG * radius;
-            float y2 = -curr.ay / maxG * radius;
-
-            QPen tracePen(traceColor, 1.0);  // Cienka linia
-            painter.setPen(tracePen);
-            painter.drawLine(QPointF(x1, y1), QPointF(x2, y2));
-        }
-    }
+    drawHistoryTrail(painter, radius);
 
     // Rysowanie srodka (punkt 0G)
     painter.setBrush(Qt::white);
@@ -120,3 +128,50 @@ void ImuGForceWidget::paintEvent(QPaintEvent *) {
     painter.setBrush(dotColor);
     painter.drawEllipse(QPointF(gx, gy), 10, 10);  // Punkt aktualnego przyspieszenia
 }
+
+// Rysowanie sladu - jedna linia lamana na poziom przezroczystosci
+void ImuGForceWidget::drawHistoryTrail(QPainter &painter, float radius) {
+    const int count = static_cast<int>(trace.size());
+    if (count < 2) return;
+
+    const qreal now = lastUpdateTime;
+    const float scale = radius / maxG;
+    const qreal bucketSeconds = traceSeconds / alphaBuckets;
+
+    painter.setBrush(Qt::NoBrush);
+    polyline.clear();
+
+    int bucket = -1;
+    for (int i = 0; i < count; ++i) {
+        const QPointF p(trace.value(0, i) * scale, -trace.value(1, i) * scale);
+
+        // Poziom przezroczystosci segmentu konczacego sie w tym punkcie
+        const qreal age = now - trace.time(i);
+        const int b = qBound(0, alphaBuckets - 1 - static_cast<int>(age / bucketSeconds), alphaBuckets - 1);
+
+        if (b != bucket) {
+            // Zmiana poziomu - narysowanie zebranego fragmentu, ostatni punkt laczy fragmenty
+            if (polyline.size() >= 2) {
+                painter.drawPolyline(polyline.constData(), polyline.size());
+            }
+            const QPointF joint = polyline.isEmpty() ? p : polyline.last();
+            polyline.clear();
+            polyline.append(joint);
+
+            QColor traceColor = Qt::blue;
+            traceColor.setAlphaF((b + 1) / static_cast<qreal>(alphaBuckets));
+            painter.setPen(QPen(traceColor, 1.0));  // Cienka linia
+            bucket = b;
+        }
+
+        // Pomijanie krokow ponizej piksela (ostatni punkt zawsze rysowany)
+        const QPointF d = p - polyline.last();
+        if (i == count - 1 || qAbs(d.x()) + qAbs(d.y()) >= 1.0) {
+            polyline.append(p);
+        }
+    }
+
+    if (polyline.size() >= 2) {
+        painter.drawPolyline(polyline.constData(), polyline.size());
+    }
+}
@@ -17,7 +17,11 @@
 #define IMUGFORCE_H
 
 #include <QWidget>
-#include <QList>
+#include <QPointF>
+#include <QVector>
+
+#include "PlatformSample.h"
+#include "SampleRing.h"
 
 /**
  * @class ImuGForceWidget
@@ -40,6 +44,15 @@ class ImuGForceWidget : public QWidget {
     Q_OBJECT
 
 public:
+    /**
+     * @struct Sample
+     * @brief One acceleration sample for the history trail
+     */
+    struct Sample {
+        qint64 timestampNs;  ///< Arrival time (monotonicNowNs() time base)
+        QPointF g;           ///< X/Y acceleration (in G-forces)
+    };
+
     /**
      * @brief Constructs a G-force visualization widget
      * @param parent Parent widget (default: nullptr)
@@ -64,6 +77,33 @@ public:
      */
     void setAcceleration(float ax, float ay);
 
+    /**
+     * @brief Appends a batch of acceleration samples with a single repaint
+     * @param samples Timestamped X/Y accelerations in chronological order
+     *
+     * @details The last sample becomes the current position; all of them
+     *          are added to the history trail with their own timestamps, so
+     *          fading and expiry follow the sample age. Intended to be called
+     *          once per display frame.
+     */
+    void addAccelerationSamples(const QVector<Sample> &samples);
+
+    /**
+     * @brief Sizes the history trail for the given input rate
+     * @param hz Expected number of acceleration samples per second
+     *
+     * @details The trail is a preallocated ring holding the 2-second history
+     *          at this rate (plus headroom); no allocation happens while
+     *          samples arrive. Faster input only shortens the visible trail.
+     *          Discards the current trail.
+     */
+    void setExpectedSampleRate(double hz);
+
+    /**
+     * @brief Input rate the trail is currently sized for (samples per second)
+     */
+    double expectedSampleRate() const { return expectedRate; }
+
     /**
      * @brief Provides the recommended minimum widget size
      * @return Minimum size in logical pixels
@@ -100,25 +140,25 @@ private:
     float accY;         ///< Current Y acceleration (G-forces)
     float maxG;         ///< Maximum displayable G-force (default: 2G)
 
-    /**
-     * @struct TracePoint
-     * @brief Stores historical acceleration data with timestamps
-     */
-    struct TracePoint {
-        float ax;       ///< Historical X acceleration value
-        float ay;       ///< Historical Y acceleration value
-        qreal timestamp;///< Time in seconds since reference
-    };
+    static constexpr qreal traceSeconds = 2.0;  ///< Length of the history trail (s)
+    static constexpr int alphaBuckets = 8;      ///< Opacity levels used to draw the trail
 
-    QList<TracePoint> trace;    ///< Buffer of recent positions (2-second history)
+    SampleRing<2> trace;        ///< Recent X/Y accelerations with timestamps (2-second history)
+    QVector<QPointF> polyline;  ///< Reused vertex buffer for drawing the trail
     qreal lastUpdateTime;       ///< Timestamp of last update
+    double expectedRate;        ///< Input rate the trail is sized for (Hz)
+
+    /**
+     * @brief Appends one point to the trail without repainting
+     */
+    void appendTracePoint(float ax, float ay, qreal now);
 
     /**
      * @brief Gets monotonic time in seconds
      * @return Current time in seconds
      *
-     * @details Used for calculating position trail ages.
-     *          Platform-independent high-resolution timer.
+     * @details Used for calculating position trail ages. Same time base as
+     *          the sample timestamps (monotonicNowNs()).
      */
     static qreal getElapsedSeconds();
 
@@ -135,14 +175,16 @@ private:
 
     /**
      * @brief Draws the position history trail
-     * @param painter Reference to active QPainter
+     * @param painter Reference to active QPainter (origin at the meter center)
+     * @param radius  Radius of the maxG circle in pixels
      *
      * @details Renders fading trail with:
-     *          - Age-based opacity (2-second fade)
-     *          - Color-coded by recency
-     *          - Smooth bezier interpolation
+     *          - Age-based opacity (2-second fade) quantized to alphaBuckets
+     *          - One polyline per opacity level
+     *          - Sub-pixel steps merged, so cost follows on-screen motion
+     *            rather than the sample rate
      */
-    void drawHistoryTrail(QPainter &painter);
+    void drawHistoryTrail(QPainter &painter, float radius);
 
     /**
      * @brief Draws the current position indicator
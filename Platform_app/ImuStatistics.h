@@ -0,0 +1,160 @@
+/**
+ * @file    ImuStatistics.h
+ * @brief   Streaming statistics of every IMU axis and of the IMU difference
+ *
+ * @details Keeps, per channel, session-wide and sliding-window (1 s, 10 s,
+ *          60 s) statistics built from StreamingStats:
+ *          - One source per IMU slot (same order as ImuBank)
+ *          - One source for the reference minus compared IMU difference
+ *          - O(1) per sample, memory allocated only when an IMU is added
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef IMUSTATISTICS_H
+#define IMUSTATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "StreamingStats.h"
+
+/**
+ * @class ImuStatistics
+ * @brief Statistics of all IMU channels, queried by source, channel and window
+ *
+ * @details Channels follow ImuBank::Channel (accelerations in m/s², angular
+ *          rates in rad/s). Single-threaded: update and query from one thread.
+ */
+class ImuStatistics
+{
+public:
+    static constexpr int kChannels = 6;     ///< ax, ay, az, gx, gy, gz
+
+    /**
+     * @enum Window
+     * @brief Time span of a summary
+     */
+    enum Window { Second, TenSeconds, Minute, Session, WindowCount };
+
+    /**
+     * @brief Registers the next IMU slot
+     * @param id IMU identifier (for display)
+     * @return Source index (equal to the ImuBank slot)
+     */
+    int addImu(int32_t id)
+    {
+        m_ids.push_back(id);
+        m_imus.emplace_back();
+        return static_cast<int>(m_imus.size()) - 1;
+    }
+
+    /**
+     * @brief Number of IMU sources
+     */
+    int imuCount() const { return static_cast<int>(m_imus.size()); }
+
+    /**
+     * @brief IMU identifier of a source
+     */
+    int32_t imuId(int source) const { return m_ids[source]; }
+
+    /**
+     * @brief Adds one sample of an IMU
+     * @param source Source index from addImu()
+     * @param values kChannels scaled values
+     * @param timestampNs Arrival time of the sample
+     */
+    void updateImu(int source, const float *values, int64_t timestampNs)
+    {
+        m_imus[source].add(values, timestampNs);
+    }
+
+    /**
+     * @brief Adds one sample of the IMU difference
+     * @param values kChannels differences (reference minus compared)
+     * @param timestampNs Arrival time of the sample
+     */
+    void updateDifference(const float *values, int64_t timestampNs) { m_difference.add(values, timestampNs); }
+
+    /**
+     * @brief Summary of one IMU channel
+     */
+    RunningStats imu(int source, int channel, Window window) const
+    {
+        return m_imus[source].summary(channel, window);
+    }
+
+    /**
+     * @brief Summary of one difference channel
+     */
+    RunningStats difference(int channel, Window window) const { return m_difference.summary(channel, window); }
+
+    /**
+     * @brief Clears the difference (e.g. when the compared IMU changes)
+     */
+    void resetDifference() { m_difference.reset(); }
+
+    /**
+     * @brief Clears all sources, keeping the registered IMUs
+     */
+    void reset()
+    {
+        for (Source &source : m_imus)
+            source.reset();
+        m_difference.reset();
+    }
+
+private:
+    /**
+     * @struct Source
+     * @brief Statistics of the channels of one stream
+     */
+    struct Source {
+        std::array<RunningStats, kChannels> session;                 ///< Since start or reset
+        std::array<std::array<WindowedStats, kChannels>, 3> windows = {{
+            filled(1000000000LL, 20),       // 1 s, 50 ms
+            filled(10000000000LL, 20),      // 10 s, 500 ms
+            filled(60000000000LL, 60),      // 60 s, 1 s
+        }};
+
+        static std::array<WindowedStats, kChannels> filled(int64_t windowNs, int buckets)
+        {
+            const WindowedStats w(windowNs, buckets);
+            return {{ w, w, w, w, w, w }};
+        }
+
+        void add(const float *values, int64_t timestampNs)
+        {
+            for (int c = 0; c < kChannels; ++c) {
+                session[c].add(values[c]);
+                for (std::array<WindowedStats, kChannels> &window : windows)
+                    window[c].add(values[c], timestampNs);
+            }
+        }
+
+        RunningStats summary(int channel, Window window) const
+        {
+            return window == Session ? session[channel] : windows[window][channel].summary();
+        }
+
+        void reset()
+        {
+            for (RunningStats &stats : session)
+                stats.reset();
+            for (std::array<WindowedStats, kChannels> &window : windows) {
+                for (WindowedStats &stats : window)
+                    stats.reset();
+            }
+        }
+    };
+
+    std::vector<int32_t> m_ids;     ///< IMU id per source
+    std::vector<Source> m_imus;     ///< Per-IMU statistics (by slot)
+    Source m_difference;            ///< Reference minus compared IMU
+};
+
+#endif // IMUSTATISTICS_H
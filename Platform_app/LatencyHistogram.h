@@ -0,0 +1,175 @@
+/**
+ * @file    LatencyHistogram.h
+ * @brief   Lock-free log-linear histogram of latencies
+ *
+ * @details Records nanosecond durations from any thread without locks:
+ *          - One relaxed atomic increment per value
+ *          - 32 linear sub-buckets per power of two (about 3% resolution)
+ *          - Exact values below 64 ns, range up to about 18 minutes
+ *          - Percentiles and maximum can be read while writers are active
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class LatencyHistogram
+ * @brief Multi-writer histogram with fixed memory and constant-time record()
+ *
+ * @details Readers see a consistent count per bucket but not a snapshot of
+ *          the whole histogram; percentiles read during heavy writing may
+ *          be off by the few values recorded meanwhile.
+ */
+class LatencyHistogram
+{
+public:
+    /**
+     * @brief Adds one duration
+     * @param ns Duration in nanoseconds (negative values count as 0)
+     */
+    void record(int64_t ns)
+    {
+        const uint64_t value = ns > 0 ? static_cast<uint64_t>(ns) : 0;
+        m_buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Number of recorded values
+     */
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Largest recorded value (ns)
+     */
+    int64_t max() const { return static_cast<int64_t>(m_max.load(std::memory_order_relaxed)); }
+
+    /**
+     * @brief Arithmetic mean (ns), 0 when empty
+     */
+    double mean() const
+    {
+        const uint64_t n = count();
+        return n ? static_cast<double>(m_sum.load(std::memory_order_relaxed)) / n : 0.0;
+    }
+
+    /**
+     * @brief Value below which the given fraction of samples lies
+     * @param fraction Quantile in 0..1 (e.g. 0.99 for p99)
+     * @return Midpoint of the matching bucket (ns), 0 when empty
+     */
+    int64_t percentile(double fraction) const
+    {
+        uint64_t total = 0;
+        for (const std::atomic<uint64_t> &bucket : m_buckets)
+            total += bucket.load(std::memory_order_relaxed);
+        if (total == 0) return 0;
+
+        const double clamped = fraction < 0.0 ? 0.0 : (fraction > 1.0 ? 1.0 : fraction);
+        uint64_t rank = static_cast<uint64_t>(clamped * total + 0.5);
+        if (rank == 0) rank = 1;
+
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBuckets; ++i) {
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                const uint64_t mid = (lowerBound(i) + upperBound(i)) / 2;
+                const int64_t top = max();
+                return static_cast<int64_t>(mid) < top ? static_cast<int64_t>(mid) : top;
+            }
+        }
+        return max();
+    }
+
+    /**
+     * @brief Clears all buckets
+     *
+     * @note Values recorded concurrently with reset() may survive it.
+     */
+    void reset()
+    {
+        for (std::atomic<uint64_t> &bucket : m_buckets)
+            bucket.store(0, std::memory_order_relaxed);
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int kSubBits = 5;                          ///< log2 of sub-buckets per octave
+    static constexpr uint64_t kSub = uint64_t(1) << kSubBits;   ///< Sub-buckets per octave
+    static constexpr int kMaxBit = 40;                          ///< Highest tracked bit (~1100 s)
+    static constexpr std::size_t kBuckets = 2 * kSub + (kMaxBit - kSubBits) * kSub; ///< Bucket count
+
+    /**
+     * @brief Bucket index of a value
+     */
+    static std::size_t bucketOf(uint64_t value)
+    {
+        if (value < 2 * kSub) return static_cast<std::size_t>(value);
+
+        int msb = highestBit(value);
+        if (msb > kMaxBit) {
+            msb = kMaxBit;
+            value = (uint64_t(1) << (kMaxBit + 1)) - 1;
+        }
+        const int shift = msb - kSubBits;
+        return static_cast<std::size_t>(2 * kSub + (shift - 1) * kSub + ((value >> shift) - kSub));
+    }
+
+    /**
+     * @brief Index of the highest set bit (value must be non-zero)
+     */
+    static int highestBit(uint64_t value)
+    {
+        int bit = 0;
+        for (int step = 32; step > 0; step /= 2) {
+            if (value >> step) {
+                value >>= step;
+                bit += step;
+            }
+        }
+        return bit;
+    }
+
+    /**
+     * @brief Smallest value of a bucket
+     */
+    static uint64_t lowerBound(std::size_t index)
+    {
+        if (index < 2 * kSub) return index;
+        const int shift = static_cast<int>((index - 2 * kSub) / kSub) + 1;
+        return (kSub + (index - 2 * kSub) % kSub) << shift;
+    }
+
+    /**
+     * @brief Largest value of a bucket
+     */
+    static uint64_t upperBound(std::size_t index)
+    {
+        if (index < 2 * kSub) return index;
+        const int shift = static_cast<int>((index - 2 * kSub) / kSub) + 1;
+        return lowerBound(index) + (uint64_t(1) << shift) - 1;
+    }
+
+    std::array<std::atomic<uint64_t>, kBuckets> m_buckets{}; ///< Per-bucket counts
+    std::atomic<uint64_t> m_count{0};                        ///< Recorded values
+    std::atomic<uint64_t> m_sum{0};                          ///< Sum for the mean
+    std::atomic<uint64_t> m_max{0};                          ///< Largest value
+};
+
+#endif // LATENCYHISTOGRAM_H
@@ -0,0 +1,46 @@
+#include "LatencyMonitor.h"
+#include <cstdio>
+
+// Nazwy etapow w raporcie
+const char *LatencyMonitor::stageName(Stage stage)
+{
+    switch (stage) {
+    case Framing:      return "framing";
+    case Validation:   return "crc";
+    case Dispatch:     return "dispatch";
+    case DisplayFrame: return "frame";
+    case PlatformView: return "3d view";
+    case ImuDisplays:  return "imu displays";
+    case GForce:       return "g-force";
+    case ErrorPlot:    return "error plot";
+    case ServoBars:    return "servos";
+    default:           return "?";
+    }
+}
+
+// Wyzerowanie wszystkich histogramow
+void LatencyMonitor::reset()
+{
+    for (LatencyHistogram &histogram : m_stages)
+        histogram.reset();
+}
+
+// Raport tekstowy (mikrosekundy)
+std::string LatencyMonitor::report() const
+{
+    std::string text;
+    char line[128];
+
+    std::snprintf(line, sizeof(line), "%-12s %10s %10s %10s %10s %10s\n",
+                  "stage", "count", "p50_us", "p99_us", "max_us", "mean_us");
+    text += line;
+
+    for (int i = 0; i < StageCount; ++i) {
+        const LatencyHistogram &h = m_stages[i];
+        std::snprintf(line, sizeof(line), "%-12s %10llu %10.1f %10.1f %10.1f %10.1f\n",
+                      stageName(static_cast<Stage>(i)), static_cast<unsigned long long>(h.count()),
+                      h.percentile(0.50) * 1e-3, h.percentile(0.99) * 1e-3, h.max() * 1e-3, h.mean() * 1e-3);
+        text += line;
+    }
+    return text;
+}
@@ -0,0 +1,86 @@
+/**
+ * @file    LatencyMonitor.h
+ * @brief   End-to-end latency statistics from byte arrival to pixels
+ *
+ * @details Every stage is measured against the moment the serial data
+ *          arrived (readyRead), so the numbers are cumulative:
+ *          - Framing and CRC validation on the reader thread
+ *          - Dispatch to the GUI thread and the display frame
+ *          - Paint of each widget and the Qt3D frame
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef LATENCYMONITOR_H
+#define LATENCYMONITOR_H
+
+#include <array>
+#include <string>
+
+#include "LatencyHistogram.h"
+
+/**
+ * @class LatencyMonitor
+ * @brief Fixed set of latency histograms, one per pipeline stage
+ *
+ * @details Histograms are lock-free, so each stage may be recorded from the
+ *          thread where it happens. The monitor itself must outlive all
+ *          writers.
+ */
+class LatencyMonitor
+{
+public:
+    /**
+     * @enum Stage
+     * @brief Measurement points, in pipeline order
+     */
+    enum Stage {
+        Framing,        ///< Frame delimiter found (reader thread)
+        Validation,     ///< Checksum and fields verified (reader thread)
+        Dispatch,       ///< Sample taken from the queue (GUI thread)
+        DisplayFrame,   ///< Accumulated state pushed to the widgets
+        PlatformView,   ///< Qt3D frame showing the new orientation
+        ImuDisplays,    ///< Paint of the IMU readouts (all IMUs)
+        GForce,         ///< Paint of the G-force trace
+        ErrorPlot,      ///< Paint of the IMU difference charts
+        ServoBars,      ///< Paint of the servo hexagon
+        StageCount
+    };
+
+    /**
+     * @brief Histogram of one stage
+     */
+    LatencyHistogram &stage(Stage stage) { return m_stages[stage]; }
+    const LatencyHistogram &stage(Stage stage) const { return m_stages[stage]; }
+
+    /**
+     * @brief Records the latency of a stage
+     * @param stage Measurement point
+     * @param sourceNs Arrival time of the data (monotonicNowNs() clock)
+     * @param nowNs Time the stage was reached
+     */
+    void record(Stage stage, int64_t sourceNs, int64_t nowNs) { m_stages[stage].record(nowNs - sourceNs); }
+
+    /**
+     * @brief Short English name of a stage (used in reports)
+     */
+    static const char *stageName(Stage stage);
+
+    /**
+     * @brief Clears all histograms
+     */
+    void reset();
+
+    /**
+     * @brief Plain text table with count, p50, p99, max and mean per stage
+     * @return Report in microseconds, one line per stage
+     */
+    std::string report() const;
+
+private:
+    std::array<LatencyHistogram, StageCount> m_stages; ///< Per-stage histograms
+};
+
+#endif // LATENCYMONITOR_H
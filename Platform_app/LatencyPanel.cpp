@@ -0,0 +1,85 @@
+#include "LatencyPanel.h"
+#include <QHeaderView>
+#include <QVBoxLayout>
+
+namespace {
+
+constexpr int kRefreshMs = 500;  // Okres odswiezania tabeli
+
+} // namespace
+
+// Konstruktor panelu opoznien
+LatencyPanel::LatencyPanel(const LatencyMonitor &monitor, QWidget *parent)
+    : QWidget(parent, Qt::Tool), m_monitor(monitor)
+{
+    m_table = new QTableWidget(LatencyMonitor::StageCount, 4, this);
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionMode(QAbstractItemView::NoSelection);
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+
+    // Komorki tworzone raz, odswiezany jest tylko tekst
+    for (int row = 0; row < LatencyMonitor::StageCount; ++row) {
+        for (int column = 0; column < 4; ++column) {
+            QTableWidgetItem *item = new QTableWidgetItem();
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            m_table->setItem(row, column, item);
+        }
+    }
+
+    m_resetButton = new QPushButton(this);
+    connect(m_resetButton, &QPushButton::clicked, this, [this]() {
+        emit resetRequested();
+        refresh();
+    });
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addWidget(m_table);
+    layout->addWidget(m_resetButton, 0, Qt::AlignRight);
+
+    connect(&m_timer, &QTimer::timeout, this, &LatencyPanel::refresh);
+    m_timer.setInterval(kRefreshMs);
+
+    retranslateUi();
+    resize(480, 360);
+}
+
+// Odswiezanie tylko przy widocznym panelu
+void LatencyPanel::showEvent(QShowEvent *event)
+{
+    refresh();
+    m_timer.start();
+    QWidget::showEvent(event);
+}
+
+void LatencyPanel::hideEvent(QHideEvent *event)
+{
+    m_timer.stop();
+    QWidget::hideEvent(event);
+}
+
+// Przepisanie percentyli do tabeli
+void LatencyPanel::refresh()
+{
+    for (int row = 0; row < LatencyMonitor::StageCount; ++row) {
+        const LatencyHistogram &h = m_monitor.stage(static_cast<LatencyMonitor::Stage>(row));
+        const bool empty = h.count() == 0;
+
+        m_table->item(row, 0)->setText(QString::number(h.count()));
+        m_table->item(row, 1)->setText(empty ? QString("-") : QString::number(h.percentile(0.50) * 1e-3, 'f', 1));
+        m_table->item(row, 2)->setText(empty ? QString("-") : QString::number(h.percentile(0.99) * 1e-3, 'f', 1));
+        m_table->item(row, 3)->setText(empty ? QString("-") : QString::number(h.max() * 1e-3, 'f', 1));
+    }
+}
+
+void LatencyPanel::retranslateUi()
+{
+    setWindowTitle(tr("Latency (byte arrival to screen)"));
+    m_table->setHorizontalHeaderLabels({ tr("Count"), tr("p50 [us]"), tr("p99 [us]"), tr("Max [us]") });
+
+    QStringList stages;
+    for (int row = 0; row < LatencyMonitor::StageCount; ++row)
+        stages << QString::fromLatin1(LatencyMonitor::stageName(static_cast<LatencyMonitor::Stage>(row)));
+    m_table->setVerticalHeaderLabels(stages);
+
+    m_resetButton->setText(tr("Reset"));
+}
@@ -0,0 +1,75 @@
+/**
+ * @file    LatencyPanel.h
+ * @brief   Diagnostics window with live latency percentiles
+ *
+ * @details Shows the LatencyMonitor statistics as a table with one row per
+ *          stage (count, p50, p99, max in microseconds). The table is
+ *          refreshed twice per second while the window is visible.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef LATENCYPANEL_H
+#define LATENCYPANEL_H
+
+#include <QWidget>
+#include <QTableWidget>
+#include <QPushButton>
+#include <QTimer>
+
+#include "LatencyMonitor.h"
+
+/**
+ * @class LatencyPanel
+ * @brief Tool window displaying end-to-end latency per stage and widget
+ */
+class LatencyPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the panel
+     * @param monitor Statistics to display (must outlive the panel)
+     * @param parent Parent widget (default: nullptr)
+     */
+    explicit LatencyPanel(const LatencyMonitor &monitor, QWidget *parent = nullptr);
+
+    /**
+     * @brief Updates all user-visible strings in the UI to reflect the current language.
+     */
+    void retranslateUi();
+
+signals:
+    /**
+     * @brief The user asked to clear the statistics
+     */
+    void resetRequested();
+
+protected:
+    /**
+     * @brief Starts periodic refresh when shown
+     */
+    void showEvent(QShowEvent *event) override;
+
+    /**
+     * @brief Stops periodic refresh when hidden
+     */
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    /**
+     * @brief Copies current percentiles into the table
+     */
+    void refresh();
+
+private:
+    const LatencyMonitor &m_monitor;  ///< Displayed statistics
+    QTableWidget *m_table;            ///< One row per stage
+    QPushButton *m_resetButton;       ///< Clears the statistics
+    QTimer m_timer;                   ///< Refresh clock
+};
+
+#endif // LATENCYPANEL_H
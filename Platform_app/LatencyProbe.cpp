@@ -0,0 +1,26 @@
+#include "LatencyProbe.h"
+#include "PlatformSample.h"
+#include <QEvent>
+
+// Konstruktor sondy opoznienia
+LatencyProbe::LatencyProbe(LatencyMonitor &monitor, LatencyMonitor::Stage stage, QObject *parent)
+    : QObject(parent), m_monitor(monitor), m_stage(stage)
+{
+}
+
+// Zapis opoznienia po wyswietleniu danych
+void LatencyProbe::presented()
+{
+    if (m_pendingNs == 0) return;
+
+    m_monitor.record(m_stage, m_pendingNs, monotonicNowNs());
+    m_pendingNs = 0;
+}
+
+// Rysowanie obserwowanego widgetu
+bool LatencyProbe::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Paint)
+        presented();
+    return QObject::eventFilter(watched, event);
+}
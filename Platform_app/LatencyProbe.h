@@ -0,0 +1,69 @@
+/**
+ * @file    LatencyProbe.h
+ * @brief   Measures when new data actually reaches a widget's pixels
+ *
+ * @details Attached to a widget as an event filter (or to a Qt3D frame
+ *          action). The GUI marks the arrival time of data handed to the
+ *          widget; the next paint records the elapsed time into one
+ *          LatencyMonitor stage.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef LATENCYPROBE_H
+#define LATENCYPROBE_H
+
+#include <QObject>
+
+#include "LatencyMonitor.h"
+
+/**
+ * @class LatencyProbe
+ * @brief Paint-time latency of the latest widget update
+ *
+ * @details The GUI marks each update with the arrival time of its oldest
+ *          data. The time is taken when the next paint event is delivered;
+ *          paints without a new update are not recorded. An update that
+ *          caused no repaint (e.g. unchanged digits) is superseded by the
+ *          next one instead of inflating the statistics. GUI thread only.
+ */
+class LatencyProbe : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Creates a probe recording into one stage
+     * @param monitor Statistics receiving the values
+     * @param stage Stage recorded on paint
+     * @param parent Parent object (default: nullptr)
+     */
+    LatencyProbe(LatencyMonitor &monitor, LatencyMonitor::Stage stage, QObject *parent = nullptr);
+
+    /**
+     * @brief Notes data handed to the widget
+     * @param sourceNs Arrival time of the oldest data in this update
+     */
+    void mark(qint64 sourceNs) { m_pendingNs = sourceNs; }
+
+public slots:
+    /**
+     * @brief The marked data has been presented; records its latency
+     */
+    void presented();
+
+protected:
+    /**
+     * @brief Calls presented() on paint events of the watched widget
+     */
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+private:
+    LatencyMonitor &m_monitor;          ///< Target statistics
+    LatencyMonitor::Stage m_stage;      ///< Stage of the watched widget
+    qint64 m_pendingNs = 0;             ///< Arrival time of the unpainted update, 0 if none
+};
+
+#endif // LATENCYPROBE_H
@@ -0,0 +1,142 @@
+#include "LineFramer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// Biale znaki usuwane z konca linii (jak QByteArray::trimmed)
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+} // namespace
+
+// Konstruktor - bufor alokowany jednorazowo
+LineFramer::LineFramer(std::size_t capacity)
+    : m_data(std::max<std::size_t>(capacity, 64))
+{
+}
+
+// Wolne miejsce w buforze (wskaznik i rozmiar po kompaktowaniu)
+LineFramer::WriteSpan LineFramer::writeSpan()
+{
+    // Kompaktowanie tylko gdy brakuje miejsca na koncu bufora
+    if (m_data.size() - m_write < m_data.size() / 4)
+        compact();
+    return { m_data.data() + m_write, m_data.size() - m_write };
+}
+
+// Zatwierdzenie odebranych bajtow
+void LineFramer::commit(std::size_t count)
+{
+    m_write += std::min(count, m_data.size() - m_write);
+}
+
+// Kopiowanie danych do bufora
+void LineFramer::append(const char *data, std::size_t size)
+{
+    while (size > 0) {
+        const WriteSpan span = writeSpan();
+        const std::size_t chunk = std::min(size, span.size);
+        std::memcpy(span.data, data, chunk);
+        commit(chunk);
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+// Wyodrebnienie kolejnej pelnej linii tekstowej
+bool LineFramer::nextLine(std::string_view &line)
+{
+    std::string_view record;
+    while (nextRecord(record, '\n')) {
+        std::size_t begin = 0;
+        std::size_t end = record.size();
+        while (begin < end && isSpace(record[begin])) ++begin;
+        while (end > begin && isSpace(record[end - 1])) --end;
+        if (begin == end) continue;
+
+        line = record.substr(begin, end - begin);
+        return true;
+    }
+    return false;
+}
+
+// Wyodrebnienie rekordu zakonczonego jednym znakiem
+bool LineFramer::nextRecord(std::string_view &record, char delimiter)
+{
+    char found;
+    return nextRecord(record, delimiter, delimiter, found);
+}
+
+// Wyodrebnienie rekordu zakonczonego jednym z dwoch znakow
+bool LineFramer::nextRecord(std::string_view &record, char first, char second, char &found)
+{
+    char *base = m_data.data();
+
+    // Zmiana separatorow - przeszukany obszar jest nieaktualny
+    const uint16_t key = static_cast<uint16_t>((static_cast<uint8_t>(first) << 8) | static_cast<uint8_t>(second));
+    if (key != m_scanKey) {
+        m_scanKey = key;
+        m_scan = m_read;
+    }
+
+    while (true) {
+        const std::size_t length = m_write - m_scan;
+        const char *delim = static_cast<const char *>(std::memchr(base + m_scan, first, length));
+        if (second != first) {
+            const std::size_t limit = delim ? static_cast<std::size_t>(delim - (base + m_scan)) : length;
+            if (const void *other = std::memchr(base + m_scan, second, limit))
+                delim = static_cast<const char *>(other);
+        }
+
+        if (!delim) {
+            m_scan = m_write;
+            // Bufor pusty - powrot na poczatek bez kopiowania
+            if (m_read == m_write)
+                m_read = m_scan = m_write = 0;
+            return false;
+        }
+
+        const std::size_t begin = m_read;
+        const std::size_t end = delim - base;
+        m_read = m_scan = end + 1;
+
+        // Koniec zbyt dlugiego rekordu - pomijamy
+        if (m_discarding) {
+            m_discarding = false;
+            continue;
+        }
+
+        found = *delim;
+        record = std::string_view(base + begin, end - begin);
+        return true;
+    }
+}
+
+// Wyczyszczenie stanu framera
+void LineFramer::reset()
+{
+    m_read = m_scan = m_write = 0;
+    m_discarding = false;
+}
+
+// Przesuniecie nieprzetworzonych bajtow na poczatek bufora
+void LineFramer::compact()
+{
+    if (m_read > 0) {
+        std::memmove(m_data.data(), m_data.data() + m_read, m_write - m_read);
+        m_scan -= m_read;
+        m_write -= m_read;
+        m_read = 0;
+    }
+
+    // Linia dluzsza niz bufor - odrzucamy ja do najblizszego '\n'
+    if (m_write == m_data.size()) {
+        if (!m_discarding)
+            ++m_overflows;
+        m_discarding = true;
+        m_read = m_scan = m_write = 0;
+    }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file    LineFramer.h
+ * @brief   Copy-free delimiter framer for the serial byte stream
+ *
+ * @details Splits a byte stream into text lines without per-line heap
+ *          allocations:
+ *          - One reusable buffer, allocated once per connection
+ *          - Bytes can be read from the device straight into the buffer
+ *          - Lines are returned as views into the received bytes
+ *          - Delimiters are located with memchr
+ *          - Text lines ('\n') and binary records (any delimiter byte)
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef LINEFRAMER_H
+#define LINEFRAMER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class LineFramer
+ * @brief Incremental delimiter framer over a compacting linear buffer
+ *
+ * @details Received bytes are appended at the write position and consumed
+ *          lines advance the read position. Unconsumed bytes (at most one
+ *          partial line) are moved to the front only when the free space at
+ *          the end runs out, so compaction is amortized O(1) per byte instead
+ *          of a front-erase per line.
+ *
+ * Each connection owns its own instance; there is no shared state.
+ *
+ * Typical use:
+ * @code
+ * const LineFramer::WriteSpan span = framer.writeSpan();
+ * framer.commit(port->read(span.data, span.size));
+ * std::string_view line;
+ * while (framer.nextLine(line)) { ... }
+ * @endcode
+ */
+class LineFramer
+{
+public:
+    /**
+     * @struct WriteSpan
+     * @brief Free space for incoming bytes
+     */
+    struct WriteSpan {
+        char *data;         ///< First free byte
+        std::size_t size;   ///< Bytes that can be written at data (at least one)
+    };
+
+    /**
+     * @brief Constructs a framer
+     * @param capacity Buffer size in bytes; a line longer than this is discarded
+     */
+    explicit LineFramer(std::size_t capacity = 64 * 1024);
+
+    /**
+     * @brief Free space for incoming bytes
+     *
+     * @details Compacts the buffer first when the free space is low, so the
+     *          pointer and the size are taken after compaction and always
+     *          describe at least one writable byte.
+     */
+    WriteSpan writeSpan();
+
+    /**
+     * @brief Marks @p count bytes written into the last writeSpan() as received
+     */
+    void commit(std::size_t count);
+
+    /**
+     * @brief Copies bytes into the framer
+     * @param data Received bytes
+     * @param size Number of bytes
+     */
+    void append(const char *data, std::size_t size);
+
+    /**
+     * @brief Extracts the next complete line
+     * @param line Receives the line with surrounding whitespace removed
+     * @return false if no complete line is buffered
+     *
+     * @details The view stays valid until the next call to writeSpan(),
+     *          append() or reset(). Empty lines are skipped.
+     */
+    bool nextLine(std::string_view &line);
+
+    /**
+     * @brief Extracts the next record terminated by @p delimiter
+     * @param record Receives the raw record without the delimiter (may be empty)
+     * @param delimiter Terminating byte
+     * @return false if no complete record is buffered
+     *
+     * @details Same view lifetime rules as nextLine(); no trimming is done.
+     */
+    bool nextRecord(std::string_view &record, char delimiter);
+
+    /**
+     * @brief Extracts the next record terminated by either of two bytes
+     * @param record Receives the raw record without the delimiter
+     * @param first First accepted delimiter
+     * @param second Second accepted delimiter
+     * @param found Receives the delimiter that ended the record
+     * @return false if no complete record is buffered
+     */
+    bool nextRecord(std::string_view &record, char first, char second, char &found);
+
+    /**
+     * @brief Number of received bytes not yet returned as a record
+     */
+    std::size_t pendingBytes() const { return m_write - m_read; }
+
+    /**
+     * @brief Discards all buffered bytes (e.g. after reconnecting)
+     */
+    void reset();
+
+    /**
+     * @brief Number of over-long lines dropped since construction
+     */
+    uint64_t overflowCount() const { return m_overflows; }
+
+private:
+    /**
+     * @brief Moves unconsumed bytes to the start of the buffer
+     *
+     * @details Drops the pending bytes if they already fill the whole buffer
+     *          without a delimiter.
+     */
+    void compact();
+
+    std::vector<char> m_data;    ///< Fixed-size storage
+    std::size_t m_read = 0;      ///< Start of unconsumed bytes
+    std::size_t m_scan = 0;      ///< Position up to which no delimiter was found
+    uint16_t m_scanKey = 0;      ///< Delimiter pair m_scan refers to
+    std::size_t m_write = 0;     ///< End of received bytes
+    bool m_discarding = false;   ///< Skipping the rest of an over-long line
+    uint64_t m_overflows = 0;    ///< Over-long lines dropped
+};
+
+#endif // LINEFRAMER_H
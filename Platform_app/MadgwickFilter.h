@@ -0,0 +1,174 @@
+/**
+ * @file    MadgwickFilter.h
+ * @brief   Streaming orientation estimate from accelerometer and gyroscope
+ *
+ * @details Implements the IMU (6-axis) variant of Madgwick's gradient
+ *          descent AHRS filter:
+ *          - The gyroscope is integrated at the full sample rate, so fast
+ *            rotations are followed without lag
+ *          - The accelerometer only corrects drift, with a gain small
+ *            enough to suppress vibration
+ *          - Accelerometer readings far from 1 g are ignored (gyro only)
+ *          - Fixed-size state, no allocation, about 100 flops per update
+ *
+ *          Yaw is not observable without a magnetometer and drifts with
+ *          the gyroscope bias.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef MADGWICKFILTER_H
+#define MADGWICKFILTER_H
+
+#include <cmath>
+
+/**
+ * @class MadgwickFilter
+ * @brief Quaternion orientation of one IMU
+ *
+ * @details The quaternion (w, x, y, z) rotates vectors from the sensor
+ *          frame to the earth frame (z up).
+ */
+class MadgwickFilter
+{
+public:
+    /**
+     * @brief Creates a filter in the level orientation
+     * @param beta Accelerometer correction gain (rad/s)
+     */
+    explicit MadgwickFilter(float beta = 0.05f) : m_beta(beta) {}
+
+    /**
+     * @brief Sets the accelerometer correction gain
+     * @param beta Larger values converge faster but pass more vibration
+     */
+    void setBeta(float beta) { m_beta = beta; }
+
+    /**
+     * @brief Accelerometer correction gain
+     */
+    float beta() const { return m_beta; }
+
+    /**
+     * @brief Sets the range of accepted accelerometer magnitudes
+     * @param gravity Magnitude of gravity in the accelerometer units
+     * @param tolerance Accepted relative deviation from @p gravity (e.g. 0.3)
+     */
+    void setAccelGate(float gravity, float tolerance)
+    {
+        m_minNorm2 = gravity * gravity * (1.0f - tolerance) * (1.0f - tolerance);
+        m_maxNorm2 = gravity * gravity * (1.0f + tolerance) * (1.0f + tolerance);
+    }
+
+    /**
+     * @brief Restores the level orientation
+     */
+    void reset()
+    {
+        m_q[0] = 1.0f;
+        m_q[1] = m_q[2] = m_q[3] = 0.0f;
+        m_initialized = false;
+    }
+
+    /**
+     * @brief Processes one sample
+     * @param gx,gy,gz Angular rate (rad/s)
+     * @param ax,ay,az Specific force (any unit, see setAccelGate())
+     * @param dt Time since the previous sample (s)
+     *
+     * @details The first sample with a valid accelerometer reading sets
+     *          roll and pitch directly, so the estimate does not have to
+     *          converge from the level orientation.
+     */
+    void update(float gx, float gy, float gz, float ax, float ay, float az, float dt)
+    {
+        float q0 = m_q[0], q1 = m_q[1], q2 = m_q[2], q3 = m_q[3];
+
+        // Rate of change of the quaternion from the gyroscope
+        float qDot0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+        float qDot1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+        float qDot2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+        float qDot3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+        const float norm2 = ax * ax + ay * ay + az * az;
+        if (norm2 >= m_minNorm2 && norm2 <= m_maxNorm2 && norm2 > 0.0f) {
+            const float inv = 1.0f / std::sqrt(norm2);
+            ax *= inv;
+            ay *= inv;
+            az *= inv;
+
+            if (!m_initialized) {
+                level(ax, ay, az);
+                return;
+            }
+
+            // Gradient of the error between measured and estimated gravity
+            const float _2q0 = 2.0f * q0, _2q1 = 2.0f * q1, _2q2 = 2.0f * q2, _2q3 = 2.0f * q3;
+            const float _4q0 = 4.0f * q0, _4q1 = 4.0f * q1, _4q2 = 4.0f * q2;
+            const float _8q1 = 8.0f * q1, _8q2 = 8.0f * q2;
+            const float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+            float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+            float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+            float s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+            float s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+
+            const float sNorm2 = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+            if (sNorm2 > 0.0f) {
+                const float sInv = m_beta / std::sqrt(sNorm2);
+                qDot0 -= s0 * sInv;
+                qDot1 -= s1 * sInv;
+                qDot2 -= s2 * sInv;
+                qDot3 -= s3 * sInv;
+            }
+        }
+
+        q0 += qDot0 * dt;
+        q1 += qDot1 * dt;
+        q2 += qDot2 * dt;
+        q3 += qDot3 * dt;
+
+        const float qInv = 1.0f / std::sqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+        m_q[0] = q0 * qInv;
+        m_q[1] = q1 * qInv;
+        m_q[2] = q2 * qInv;
+        m_q[3] = q3 * qInv;
+    }
+
+    float w() const { return m_q[0]; }  ///< Scalar part
+    float x() const { return m_q[1]; }  ///< X component
+    float y() const { return m_q[2]; }  ///< Y component
+    float z() const { return m_q[3]; }  ///< Z component
+
+private:
+    /**
+     * @brief Sets roll and pitch from a normalized gravity reading (yaw 0)
+     */
+    void level(float ax, float ay, float az)
+    {
+        // Shortest rotation taking the measured "up" vector to earth z
+        const float w = 1.0f + az;
+        if (w < 1e-6f) {
+            m_q[0] = 0.0f;
+            m_q[1] = 1.0f;
+            m_q[2] = m_q[3] = 0.0f;
+        } else {
+            const float inv = 1.0f / std::sqrt(w * w + ay * ay + ax * ax);
+            m_q[0] = w * inv;
+            m_q[1] = ay * inv;
+            m_q[2] = -ax * inv;
+            m_q[3] = 0.0f;
+        }
+        m_initialized = true;
+    }
+
+    float m_q[4] = { 1.0f, 0.0f, 0.0f, 0.0f };  ///< Orientation (w, x, y, z)
+    float m_beta;                               ///< Correction gain
+    float m_minNorm2 = 0.0f;                    ///< Smallest accepted |a|², 0 accepts all
+    float m_maxNorm2 = 1e30f;                   ///< Largest accepted |a|²
+    bool m_initialized = false;                 ///< Roll and pitch set from gravity
+};
+
+#endif // MADGWICKFILTER_H
@@ -0,0 +1,56 @@
+/**
+ * @file    PlatformSample.h
+ * @brief   Decoded sample exchanged between serial ingestion and the GUI
+ *
+ * @details Plain value type produced by the ingestion thread after framing
+ *          and CRC validation. It carries raw sensor units only; scaling to
+ *          SI units is done by the consumer.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef PLATFORMSAMPLE_H
+#define PLATFORMSAMPLE_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @struct PlatformSample
+ * @brief Single validated IMU or servo frame
+ *
+ * @details For IMU frames @c values holds ax, ay, az, gx, gy, gz in raw
+ *          sensor LSB. For servo frames it holds the six servo angles
+ *          in degrees and @c imuId is unused.
+ */
+struct PlatformSample {
+    /**
+     * @enum Type
+     * @brief Kind of frame the sample was decoded from
+     */
+    enum class Type : uint8_t {
+        Imu,    ///< "IMU:" frame
+        Servo   ///< "S:" frame
+    };
+
+    Type type = Type::Imu;     ///< Frame type
+    int32_t imuId = 0;         ///< IMU identifier (IMU frames only)
+    int16_t values[6] = {};    ///< Raw field values
+    int64_t timestampNs = 0;   ///< Host monotonic time of arrival (ns)
+};
+
+/**
+ * @brief Current host monotonic time
+ * @return Nanoseconds since an arbitrary, fixed epoch
+ *
+ * @details Shared time base for sample timestamps on every thread.
+ */
+inline int64_t monotonicNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif // PLATFORMSAMPLE_H
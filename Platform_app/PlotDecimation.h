@@ -0,0 +1,82 @@
+/**
+ * @file    PlotDecimation.h
+ * @brief   Display-aware downsampling of plot data
+ *
+ * @details Reduces a time series to what a plot can actually show:
+ *          - One bucket per pixel column of the plot area
+ *          - Minimum and maximum of every bucket are kept, so spikes stay visible
+ *          - Output size is bounded by the width, not by the sample rate
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef PLOTDECIMATION_H
+#define PLOTDECIMATION_H
+
+#include <QPointF>
+#include <QVector>
+
+#include "SampleRing.h"
+
+/**
+ * @brief Min/max decimation of one ring buffer channel
+ * @tparam Channels Channel count of the ring
+ * @param ring    Source samples (chronological)
+ * @param channel Channel to decimate
+ * @param start   Time shown at the left edge of the plot
+ * @param end     Time shown at the right edge of the plot
+ * @param columns Plot width in pixels
+ * @param out     Receives at most 2 * columns points in time order
+ *
+ * @details When the ring holds no more than two points per column, every
+ *          sample is copied unchanged. Otherwise the samples are grouped by
+ *          pixel column and each group contributes its extreme values in
+ *          the order they occurred, which keeps the drawn envelope identical
+ *          to drawing all samples.
+ */
+template <std::size_t Channels>
+void decimateMinMax(const SampleRing<Channels> &ring, std::size_t channel,
+                    double start, double end, int columns, QVector<QPointF> &out)
+{
+    out.clear();
+    const std::size_t count = ring.size();
+    if (count == 0) return;
+
+    columns = qMax(1, columns);
+    if (count <= static_cast<std::size_t>(2 * columns) || end <= start) {
+        out.reserve(static_cast<int>(count));
+        for (std::size_t i = 0; i < count; ++i)
+            out.append(QPointF(ring.time(i), ring.value(channel, i)));
+        return;
+    }
+
+    out.reserve(2 * columns + 2);
+    const double scale = columns / (end - start);
+
+    std::size_t i = 0;
+    while (i < count) {
+        // Samples falling into the same pixel column
+        const long column = static_cast<long>((ring.time(i) - start) * scale);
+        std::size_t minIndex = i;
+        std::size_t maxIndex = i;
+        float minValue = ring.value(channel, i);
+        float maxValue = minValue;
+
+        for (++i; i < count && static_cast<long>((ring.time(i) - start) * scale) == column; ++i) {
+            const float v = ring.value(channel, i);
+            if (v < minValue) { minValue = v; minIndex = i; }
+            if (v > maxValue) { maxValue = v; maxIndex = i; }
+        }
+
+        // Extremes in the order they occurred
+        const std::size_t first = qMin(minIndex, maxIndex);
+        const std::size_t second = qMax(minIndex, maxIndex);
+        out.append(QPointF(ring.time(first), ring.value(channel, first)));
+        if (second != first)
+            out.append(QPointF(ring.time(second), ring.value(channel, second)));
+    }
+}
+
+#endif // PLOTDECIMATION_H
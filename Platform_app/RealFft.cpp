@@ -0,0 +1,89 @@
+#include "RealFft.h"
+
+#include <cmath>
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Mnozenie zespolone bez obslugi NaN/Inf z std::complex (kilkukrotnie szybsze)
+inline std::complex<float> multiply(const std::complex<float> &a, const std::complex<float> &b)
+{
+    return std::complex<float>(a.real() * b.real() - a.imag() * b.imag(),
+                               a.real() * b.imag() + a.imag() * b.real());
+}
+
+} // namespace
+
+// Konstruktor - tablice wspolczynnikow i permutacji
+RealFft::RealFft(std::size_t size)
+    : m_size(isValidSize(size) ? size : 4)
+{
+    const std::size_t half = m_size / 2;
+
+    m_twiddle.resize(half / 2);
+    for (std::size_t k = 0; k < m_twiddle.size(); ++k) {
+        const double angle = -2.0 * kPi * k / half;
+        m_twiddle[k] = std::complex<float>(std::cos(angle), std::sin(angle));
+    }
+
+    m_split.resize(half);
+    for (std::size_t k = 0; k < half; ++k) {
+        const double angle = -2.0 * kPi * k / m_size;
+        m_split[k] = std::complex<float>(std::cos(angle), std::sin(angle));
+    }
+
+    // Odwrocenie bitow indeksu dla FFT N/2 punktow
+    m_bitReverse.resize(half);
+    std::size_t bits = 0;
+    while ((std::size_t(1) << bits) < half)
+        ++bits;
+    for (std::size_t i = 0; i < half; ++i) {
+        std::size_t reversed = 0;
+        for (std::size_t b = 0; b < bits; ++b) {
+            if (i & (std::size_t(1) << b)) reversed |= std::size_t(1) << (bits - 1 - b);
+        }
+        m_bitReverse[i] = reversed;
+    }
+
+    m_work.resize(half);
+    m_output.resize(half + 1);
+}
+
+// Transformata N probek rzeczywistych
+const std::complex<float> *RealFft::transform(const float *input)
+{
+    const std::size_t half = m_size / 2;
+
+    // Pary probek jako liczby zespolone, od razu w kolejnosci odwroconych bitow
+    for (std::size_t i = 0; i < half; ++i)
+        m_work[m_bitReverse[i]] = std::complex<float>(input[2 * i], input[2 * i + 1]);
+
+    // Motylki radix-2
+    for (std::size_t length = 2; length <= half; length <<= 1) {
+        const std::size_t step = half / length;
+        const std::size_t span = length / 2;
+        for (std::size_t start = 0; start < half; start += length) {
+            for (std::size_t k = 0; k < span; ++k) {
+                const std::complex<float> t = multiply(m_twiddle[k * step], m_work[start + k + span]);
+                const std::complex<float> u = m_work[start + k];
+                m_work[start + k] = u + t;
+                m_work[start + k + span] = u - t;
+            }
+        }
+    }
+
+    // Rozdzielenie widm probek parzystych i nieparzystych
+    const std::complex<float> z0 = m_work[0];
+    m_output[0] = std::complex<float>(z0.real() + z0.imag(), 0.0f);
+    m_output[half] = std::complex<float>(z0.real() - z0.imag(), 0.0f);
+    for (std::size_t k = 1; k < half; ++k) {
+        const std::complex<float> a = m_work[k];
+        const std::complex<float> b = std::conj(m_work[half - k]);
+        const std::complex<float> even = 0.5f * (a + b);
+        const std::complex<float> diff = a - b;
+        const std::complex<float> odd(0.5f * diff.imag(), -0.5f * diff.real());  // -i/2 * diff
+        m_output[k] = even + multiply(m_split[k], odd);
+    }
+    return m_output.data();
+}
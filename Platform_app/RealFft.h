@@ -0,0 +1,69 @@
+/**
+ * @file    RealFft.h
+ * @brief   Power-of-two FFT of real signals with precomputed tables
+ *
+ * @details Computes the spectrum of N real samples with one complex
+ *          radix-2 FFT of N/2 points plus a split step:
+ *          - Twiddle factors and the bit-reversal permutation are computed
+ *            once in the constructor
+ *          - transform() works in member buffers, no allocation per call
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef REALFFT_H
+#define REALFFT_H
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class RealFft
+ * @brief Forward FFT of a fixed size
+ *
+ * @details Not thread-safe: one instance per thread.
+ */
+class RealFft
+{
+public:
+    /**
+     * @brief Prepares the tables for one transform size
+     * @param size Number of input samples, a power of two >= 4
+     */
+    explicit RealFft(std::size_t size);
+
+    /**
+     * @brief Number of input samples
+     */
+    std::size_t size() const { return m_size; }
+
+    /**
+     * @brief Number of output bins (size / 2 + 1, DC to Nyquist)
+     */
+    std::size_t bins() const { return m_size / 2 + 1; }
+
+    /**
+     * @brief Transforms size() real samples
+     * @param input Time-domain samples
+     * @return bins() complex coefficients (valid until the next call)
+     */
+    const std::complex<float> *transform(const float *input);
+
+    /**
+     * @brief True if @p size is a supported transform size
+     */
+    static bool isValidSize(std::size_t size) { return size >= 4 && (size & (size - 1)) == 0; }
+
+private:
+    std::size_t m_size;                         ///< Real input length N
+    std::vector<std::complex<float>> m_twiddle; ///< exp(-2πi k / (N/2)), k < N/4
+    std::vector<std::complex<float>> m_split;   ///< exp(-2πi k / N), k < N/2
+    std::vector<std::size_t> m_bitReverse;      ///< Permutation of the N/2-point FFT
+    std::vector<std::complex<float>> m_work;    ///< Packed input / half-size spectrum
+    std::vector<std::complex<float>> m_output;  ///< Result bins
+};
+
+#endif // REALFFT_H
@@ -0,0 +1,150 @@
+/**
+ * @file    SampleMerger.h
+ * @brief   Timestamp-ordered merge of the sample queues of several readers
+ *
+ * @details Every serial port has its own reader thread and queue, each
+ *          ordered by arrival time. The merger interleaves them into one
+ *          stream with non-decreasing timestamps:
+ *          - k-way merge on the queue fronts, no copying or allocation
+ *          - A sample is held back only while another reader may still
+ *            publish an older one (it is in the middle of a batch)
+ *          - An idle or slow port never delays the others
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SAMPLEMERGER_H
+#define SAMPLEMERGER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "PlatformSample.h"
+#include "SpscQueue.h"
+
+/**
+ * @class SampleMerger
+ * @brief Consumer side of several SPSC sample queues
+ *
+ * @details Each source publishes a "busy since" value next to its queue:
+ *          0 while idle, kBusyUnknown while it is about to read the clock,
+ *          and the arrival time of the batch it is decoding otherwise.
+ *          Samples of that batch are never older than that time, which
+ *          bounds what may be released from the other queues.
+ *
+ * Consumer thread only.
+ */
+class SampleMerger
+{
+public:
+    static constexpr int64_t kIdle = 0;          ///< Source has no batch in flight
+    static constexpr int64_t kBusyUnknown = -1;  ///< Batch started, arrival time not yet set
+
+    /**
+     * @brief Adds a source
+     * @param queue Queue filled by the source (must outlive its registration)
+     * @param busySinceNs State published by the source (see class details)
+     */
+    void addSource(SpscQueue<PlatformSample> *queue, const std::atomic<int64_t> *busySinceNs)
+    {
+        m_sources.push_back({ queue, busySinceNs });
+    }
+
+    /**
+     * @brief Removes a source (drain its queue first with drainSource())
+     */
+    void removeSource(const SpscQueue<PlatformSample> *queue)
+    {
+        m_sources.erase(std::remove_if(m_sources.begin(), m_sources.end(),
+                                       [queue](const Source &source) { return source.queue == queue; }),
+                        m_sources.end());
+    }
+
+    /**
+     * @brief Number of registered sources
+     */
+    std::size_t sourceCount() const { return m_sources.size(); }
+
+    /**
+     * @brief Releases queued samples in timestamp order
+     * @param consume Called with each released sample
+     * @param all true to release every queued sample (final drain when the
+     *        sources stopped or their remaining order does not matter)
+     * @return true if samples are held back and drain() should be retried shortly
+     */
+    template <typename Consumer>
+    bool drain(Consumer &&consume, bool all = false)
+    {
+        // Bound below which no source can still publish a sample
+        const int64_t now = monotonicNowNs();
+        int64_t limit = std::numeric_limits<int64_t>::max();
+        for (const Source &source : m_sources) {
+            if (all) break;
+            const int64_t busy = source.busySinceNs->load(std::memory_order_acquire);
+            const int64_t bound = (busy == kIdle) ? now
+                                : (busy == kBusyUnknown) ? std::numeric_limits<int64_t>::min() : busy;
+            limit = std::min(limit, bound);
+        }
+
+        while (Source *oldest = oldestSource()) {
+            const PlatformSample *sample = oldest->queue->front();
+            if (sample->timestampNs > limit) return true;
+
+            consume(*sample);
+            oldest->queue->pop();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Releases every sample of one source before it is removed
+     * @param queue Queue of a source whose producer has stopped
+     * @param consume Called with each released sample
+     *
+     * @details Samples of the other sources that are older than the last
+     *          sample of @p queue are released with it, so the output stays
+     *          in timestamp order; newer ones remain queued for drain().
+     */
+    template <typename Consumer>
+    void drainSource(SpscQueue<PlatformSample> *queue, Consumer &&consume)
+    {
+        while (queue->front()) {
+            Source *oldest = oldestSource();
+            consume(*oldest->queue->front());
+            oldest->queue->pop();
+        }
+    }
+
+private:
+    /**
+     * @struct Source
+     * @brief One registered reader
+     */
+    struct Source {
+        SpscQueue<PlatformSample> *queue;           ///< Samples of the reader
+        const std::atomic<int64_t> *busySinceNs;    ///< Batch state of the reader
+    };
+
+    /**
+     * @brief Source with the oldest queue front, nullptr if all queues are empty
+     */
+    Source *oldestSource()
+    {
+        Source *oldest = nullptr;
+        for (Source &source : m_sources) {
+            const PlatformSample *sample = source.queue->front();
+            if (sample && (!oldest || sample->timestampNs < oldest->queue->front()->timestampNs))
+                oldest = &source;
+        }
+        return oldest;
+    }
+
+    std::vector<Source> m_sources;  ///< Registered readers
+};
+
+#endif // SAMPLEMERGER_H
@@ -0,0 +1,155 @@
+/**
+ * @file    SampleRing.h
+ * @brief   Fixed-capacity history of timestamped multi-channel samples
+ *
+ * @details Backing store for rolling time plots:
+ *          - Storage is allocated once per capacity change
+ *          - Appending overwrites the oldest sample when full
+ *          - Dropping samples older than a time limit is O(1) amortized
+ *          - Channels are stored as compact float arrays
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SAMPLERING_H
+#define SAMPLERING_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class SampleRing
+ * @brief Circular buffer of (time, value[Channels]) samples
+ * @tparam Channels Number of values stored per sample
+ *
+ * @details Samples must be pushed in non-decreasing time order. Index 0 is
+ *          always the oldest retained sample.
+ */
+template <std::size_t Channels>
+class SampleRing
+{
+public:
+    /**
+     * @brief Creates a ring able to hold @p capacity samples
+     * @param capacity Maximum number of retained samples (at least 1)
+     */
+    explicit SampleRing(std::size_t capacity) { setCapacity(capacity); }
+
+    /**
+     * @brief Changes the capacity and discards all samples
+     * @param capacity Maximum number of retained samples (at least 1)
+     */
+    void setCapacity(std::size_t capacity)
+    {
+        capacity = std::max<std::size_t>(capacity, 1);
+        m_time.assign(capacity, 0.0);
+        for (std::vector<float> &channel : m_values)
+            channel.assign(capacity, 0.0f);
+        clear();
+    }
+
+    /**
+     * @brief Maximum number of retained samples
+     */
+    std::size_t capacity() const { return m_time.size(); }
+
+    /**
+     * @brief Number of retained samples
+     */
+    std::size_t size() const { return m_size; }
+
+    /**
+     * @brief True if no samples are retained
+     */
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Memory used by the sample storage in bytes
+     */
+    std::size_t memoryFootprint() const
+    {
+        return capacity() * (sizeof(double) + Channels * sizeof(float));
+    }
+
+    /**
+     * @brief Discards all samples (storage is kept)
+     */
+    void clear()
+    {
+        m_first = 0;
+        m_size = 0;
+    }
+
+    /**
+     * @brief Appends a sample, overwriting the oldest one when full
+     * @param time   Sample time; must not be earlier than the newest sample
+     * @param values Channels values of the sample
+     */
+    void push(double time, const float *values)
+    {
+        const std::size_t cap = capacity();
+        std::size_t slot = m_first + m_size;
+        if (slot >= cap) slot -= cap;
+
+        m_time[slot] = time;
+        for (std::size_t c = 0; c < Channels; ++c)
+            m_values[c][slot] = values[c];
+
+        if (m_size < cap) {
+            ++m_size;
+        } else if (++m_first == cap) {
+            m_first = 0;
+        }
+    }
+
+    /**
+     * @brief Discards all samples older than @p time
+     *
+     * @details Each sample is discarded at most once, so the cost is
+     *          amortized over the pushes.
+     */
+    void dropBefore(double time)
+    {
+        const std::size_t cap = capacity();
+        while (m_size > 0 && m_time[m_first] < time) {
+            if (++m_first == cap) m_first = 0;
+            --m_size;
+        }
+    }
+
+    /**
+     * @brief Time of the i-th oldest sample
+     */
+    double time(std::size_t i) const { return m_time[index(i)]; }
+
+    /**
+     * @brief Value of channel @p channel of the i-th oldest sample
+     */
+    float value(std::size_t channel, std::size_t i) const { return m_values[channel][index(i)]; }
+
+    /**
+     * @brief Time of the newest sample (ring must not be empty)
+     */
+    double lastTime() const { return time(m_size - 1); }
+
+private:
+    /**
+     * @brief Maps a logical position (0 = oldest) to a storage slot
+     */
+    std::size_t index(std::size_t i) const
+    {
+        const std::size_t slot = m_first + i;
+        return slot < capacity() ? slot : slot - capacity();
+    }
+
+    std::vector<double> m_time;                            ///< Sample times
+    std::array<std::vector<float>, Channels> m_values;     ///< Per-channel values
+    std::size_t m_first = 0;                               ///< Slot of the oldest sample
+    std::size_t m_size = 0;                                ///< Number of retained samples
+};
+
+#endif // SAMPLERING_H
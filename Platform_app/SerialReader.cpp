@@ -0,0 +1,169 @@
+#include "SerialReader.h"
+#include <QDebug>
+
+namespace {
+
+// Widok linii jako QByteArray (tylko do komunikatow diagnostycznych)
+inline QByteArray toByteArray(std::string_view line)
+{
+    return QByteArray::fromRawData(line.data(), static_cast<int>(line.size()));
+}
+
+} // namespace
+
+// Konstruktor czytnika portu szeregowego
+SerialReader::SerialReader(std::size_t queueCapacity, QObject *parent)
+    : QObject(parent), m_queue(queueCapacity)
+{
+}
+
+// Pomiar opoznien ramkowania i walidacji
+void SerialReader::setLatencyMonitor(LatencyMonitor *monitor)
+{
+    m_latency = monitor;
+    m_decoder.setTimestamps(monitor != nullptr);
+}
+
+// Otwarcie portu (wywolywane w watku czytnika)
+void SerialReader::open(const QString &portName, qint32 baudRate)
+{
+    if (!m_serial) {
+        // Port tworzony w watku czytnika, aby nalezal do jego petli zdarzen
+        m_serial = new QSerialPort(this);
+        connect(m_serial, &QSerialPort::readyRead, this, &SerialReader::readSerialData);
+    }
+
+    if (m_serial->isOpen())
+        m_serial->close();
+
+    m_decoder.reset();
+    publishCounters();
+    m_reportedProtocol = StreamDecoder::Protocol::Unknown;
+    m_serial->setPortName(portName);
+    m_serial->setBaudRate(baudRate);
+
+    if (m_serial->open(QIODevice::ReadWrite)) {
+        emit connectionChanged(true, QString());
+    } else {
+        emit connectionChanged(false, m_serial->errorString());
+    }
+}
+
+// Zamkniecie portu
+void SerialReader::close()
+{
+    if (m_serial && m_serial->isOpen())
+        m_serial->close();
+
+    m_decoder.reset();
+    publishCounters();
+    m_reportedProtocol = StreamDecoder::Protocol::Unknown;
+    emit connectionChanged(false, QString());
+}
+
+// Przekazanie probki do nagrania i do kolejki GUI
+void SerialReader::publish(const PlatformSample &sample)
+{
+    // Nagranie niezalezne od tego, czy GUI nadaza z odbiorem
+    if (m_recorderInput) m_recorderInput->record(sample);
+
+    if (!m_queue.tryPush(sample)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Odczyt danych z portu szeregowego
+void SerialReader::readSerialData()
+{
+    // Paczka w toku - scalanie w GUI wstrzymuje nowsze probki innych portow
+    m_busySinceNs.store(SampleMerger::kBusyUnknown, std::memory_order_seq_cst);
+    const int64_t arrivalNs = monotonicNowNs();
+    m_busySinceNs.store(arrivalNs, std::memory_order_release);
+
+    // Odczyt bezposrednio do bufora dekodera, bez posrednich kopii
+    while (m_serial->bytesAvailable() > 0) {
+        // Wskaznik i rozmiar pobierane razem, po kompaktowaniu bufora
+        const LineFramer::WriteSpan span = m_decoder.writeSpan();
+        const qint64 received = m_serial->read(span.data, static_cast<qint64>(span.size));
+        if (received <= 0) break;
+        m_decoder.commit(static_cast<std::size_t>(received));
+
+        PlatformSample sample;
+        for (StreamDecoder::Result result = m_decoder.next(sample);
+             result.status != StreamDecoder::Status::NeedMoreData;
+             result = m_decoder.next(sample)) {
+            if (result.status == StreamDecoder::Status::Ok) {
+                sample.timestampNs = arrivalNs;
+                if (m_latency) {
+                    m_latency->record(LatencyMonitor::Framing, arrivalNs, result.framedNs);
+                    m_latency->record(LatencyMonitor::Validation, arrivalNs, monotonicNowNs());
+                }
+                publish(sample);
+            } else {
+                reportError(result);
+            }
+        }
+    }
+
+    m_busySinceNs.store(SampleMerger::kIdle, std::memory_order_release);
+    publishCounters();
+
+    // Zmiana wykrytego protokolu (ASCII/binarny)
+    if (m_decoder.protocol() != m_reportedProtocol) {
+        m_reportedProtocol = m_decoder.protocol();
+        emit protocolChanged(protocolName(m_reportedProtocol));
+    }
+
+    // Jedno powiadomienie GUI na cala paczke danych
+    if (m_queue.size() > 0 && !m_notifyPending.exchange(true, std::memory_order_acq_rel)) {
+        emit samplesAvailable();
+    }
+}
+
+// Liczniki dekodera dla GUI
+void SerialReader::publishCounters()
+{
+    m_frames.store(m_decoder.counters().frames, std::memory_order_relaxed);
+    m_errors.store(m_decoder.counters().errors, std::memory_order_relaxed);
+}
+
+// Nazwa protokolu do wyswietlenia w GUI
+QString SerialReader::protocolName(StreamDecoder::Protocol protocol)
+{
+    switch (protocol) {
+    case StreamDecoder::Protocol::Ascii:  return QStringLiteral("ASCII");
+    case StreamDecoder::Protocol::Binary: return QStringLiteral("BIN");
+    default:                              return QString();
+    }
+}
+
+// Komunikaty o odrzuconych ramkach
+void SerialReader::reportError(const StreamDecoder::Result &result)
+{
+    const bool servo = (result.type == PlatformSample::Type::Servo);
+
+    if (result.protocol == StreamDecoder::Protocol::Binary) {
+        qWarning() << "Invalid binary frame (" << static_cast<int>(result.status) << "):"
+                   << toByteArray(result.frame).toHex();
+        return;
+    }
+
+    switch (result.status) {
+    case StreamDecoder::Status::BadCrcFormat:
+        qWarning() << (servo ? "Invalid CRC format in servo line:" : "Invalid CRC format:") << toByteArray(result.frame);
+        break;
+    case StreamDecoder::Status::BadFieldCount:
+        qWarning() << (servo ? "Invalid servo data field count:" : "Invalid data field count:") << toByteArray(result.frame);
+        break;
+    case StreamDecoder::Status::BadValue:
+        qWarning() << (servo ? "Invalid servo angle conversion:" : "Invalid IMU data conversion:") << toByteArray(result.frame);
+        break;
+    case StreamDecoder::Status::CrcMismatch:
+        qWarning() << (servo ? "Servo CRC mismatch. Received:" : "CRC mismatch. Received:") << result.receivedCrc
+                   << "Calculated:" << result.calculatedCrc;
+        break;
+    default:
+        qDebug() << "Received unrecognized data:" << toByteArray(result.frame);
+        break;
+    }
+}
@@ -0,0 +1,191 @@
+/**
+ * @file    SerialReader.h
+ * @brief   Serial port ingestion worker running on a dedicated thread
+ *
+ * @details Owns the QSerialPort together with framing, protocol detection
+ *          and CRC validation. Decoded samples are handed to the GUI thread through
+ *          a bounded lock-free queue, so the GUI never touches raw bytes and
+ *          a busy event loop cannot stall the serial port. Several readers
+ *          can run side by side (one per port); their queues are merged
+ *          by SampleMerger.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SERIALREADER_H
+#define SERIALREADER_H
+
+#include <QObject>
+#include <QSerialPort>
+#include <atomic>
+
+#include "LatencyMonitor.h"
+#include "PlatformSample.h"
+#include "SampleMerger.h"
+#include "SessionRecorder.h"
+#include "SpscQueue.h"
+#include "StreamDecoder.h"
+
+/**
+ * @class SerialReader
+ * @brief Reads, frames and validates serial data off the GUI thread
+ *
+ * @details Intended to be moved to its own QThread. All slots run on that
+ *          thread; the GUI interacts with it only through queued calls,
+ *          the signals below and the sample queue.
+ *
+ * Wake-up signals are coalesced: samplesAvailable() is emitted once and not
+ * again until the consumer calls rearmNotification(), so a slow GUI receives
+ * one event per drain instead of one per line.
+ */
+class SerialReader : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the reader
+     * @param queueCapacity Number of samples buffered for the GUI
+     * @param parent Parent object (default: nullptr)
+     */
+    explicit SerialReader(std::size_t queueCapacity = 16384, QObject *parent = nullptr);
+
+    /**
+     * @brief Queue of decoded samples (consumed by the GUI thread)
+     */
+    SpscQueue<PlatformSample> &queue() { return m_queue; }
+
+    /**
+     * @brief Re-enables the samplesAvailable() signal
+     *
+     * @details Must be called by the consumer before it starts draining
+     *          the queue. Thread-safe.
+     */
+    void rearmNotification() { m_notifyPending.store(false, std::memory_order_release); }
+
+    /**
+     * @brief Number of samples dropped because the queue was full. Thread-safe.
+     */
+    quint64 droppedSamples() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Valid frames decoded since the port was opened. Thread-safe.
+     */
+    quint64 validFrames() const { return m_frames.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Frames rejected by validation since the port was opened. Thread-safe.
+     */
+    quint64 rejectedFrames() const { return m_errors.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Batch state for SampleMerger (see SampleMerger::kIdle)
+     */
+    const std::atomic<int64_t> &busySinceNs() const { return m_busySinceNs; }
+
+    /**
+     * @brief Enables recording of the framing and validation latencies
+     * @param monitor Statistics to record into, nullptr to disable
+     *
+     * @details Must be called before the reader is moved to its thread.
+     */
+    void setLatencyMonitor(LatencyMonitor *monitor);
+
+    /**
+     * @brief Hands every validated sample to a session recorder input
+     * @param input Input registered for this reader, nullptr to disable
+     *
+     * @details Samples are recorded before the GUI queue, so a GUI that
+     *          falls behind does not lose them from the session. Must be
+     *          called before the reader is moved to its thread.
+     */
+    void setRecorderInput(SessionRecorder::Input *input) { m_recorderInput = input; }
+
+public slots:
+    /**
+     * @brief Opens the serial port
+     * @param portName System name or device path of the port
+     * @param baudRate Baud rate to configure
+     *
+     * @details Emits connectionChanged() with the result.
+     */
+    void open(const QString &portName, qint32 baudRate);
+
+    /**
+     * @brief Closes the serial port and discards partially received data
+     */
+    void close();
+
+signals:
+    /**
+     * @brief Reports a change of the port state
+     * @param connected true when the port is open
+     * @param error Error description when opening failed, empty otherwise
+     */
+    void connectionChanged(bool connected, const QString &error);
+
+    /**
+     * @brief New samples were pushed to an empty or already drained queue
+     */
+    void samplesAvailable();
+
+    /**
+     * @brief The detected wire protocol changed
+     * @param name Short protocol name ("ASCII", "BIN") or empty while detecting
+     */
+    void protocolChanged(const QString &name);
+
+private slots:
+    /**
+     * @brief Processes incoming serial data
+     *
+     * @details Reads and parses data from the serial port,
+     *          supporting two message formats:
+     *          1. IMU data packets (format: "IMU:<id>,<ax>,<ay>,<az>,<gx>,<gy>,<gz>*<crc>")
+     *          2. Servo data packets (format: "S:<a1>,<a2>,<a3>,<a4>,<a5>,<a6>*<crc>")
+     *
+     *          The same samples may instead arrive as COBS framed binary
+     *          records (see BinaryProtocol); the format is detected
+     *          automatically. Validates checksums and queues decoded
+     *          samples for the GUI.
+     */
+    void readSerialData();
+
+private:
+    /**
+     * @brief Records a sample and pushes it to the GUI queue, counting drops on overflow
+     */
+    void publish(const PlatformSample &sample);
+
+    /**
+     * @brief Copies the decoder counters to the thread-safe members
+     */
+    void publishCounters();
+
+    /**
+     * @brief Logs a rejected frame
+     * @param result Decoder result describing the problem
+     */
+    void reportError(const StreamDecoder::Result &result);
+
+    /**
+     * @brief Short protocol name shown in the GUI
+     */
+    static QString protocolName(StreamDecoder::Protocol protocol);
+
+    QSerialPort *m_serial = nullptr;          ///< Port, created lazily on the reader thread
+    StreamDecoder m_decoder;                  ///< Per-connection framing and validation
+    StreamDecoder::Protocol m_reportedProtocol = StreamDecoder::Protocol::Unknown; ///< Last protocol sent to the GUI
+    SpscQueue<PlatformSample> m_queue;        ///< Decoded samples for the GUI
+    std::atomic<bool> m_notifyPending{false}; ///< Wake-up already sent and not yet consumed
+    std::atomic<quint64> m_dropped{0};        ///< Samples lost to queue overflow
+    std::atomic<quint64> m_frames{0};         ///< Decoder counters published for the GUI
+    std::atomic<quint64> m_errors{0};         ///< Rejected frames published for the GUI
+    std::atomic<int64_t> m_busySinceNs{0};    ///< Arrival time of the batch being decoded
+    LatencyMonitor *m_latency = nullptr;      ///< Optional latency statistics
+    SessionRecorder::Input *m_recorderInput = nullptr; ///< Optional session recording
+};
+
+#endif // SERIALREADER_H
@@ -0,0 +1,97 @@
+#include "SessionFile.h"
+#include "Crc16.h"
+
+// Otwarcie pliku sesji i przeglad naglowkow fragmentow
+bool SessionFile::open(const QString &path, QString *error)
+{
+    close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly)) {
+        if (error) *error = m_file.errorString();
+        return false;
+    }
+
+    SessionFileHeader header;
+    if (m_file.read(reinterpret_cast<char *>(&header), sizeof(header)) != sizeof(header)
+        || std::memcmp(header.magic, kSessionMagic, sizeof(header.magic)) != 0) {
+        if (error) *error = QObject::tr("Not a session file");
+        close();
+        return false;
+    }
+    if (header.version != kSessionVersion || header.recordSize != sizeof(SessionRecord)) {
+        if (error) *error = QObject::tr("Unsupported session file version");
+        close();
+        return false;
+    }
+
+    // Przeglad fragmentow bez czytania danych
+    SessionChunkHeader chunk;
+    bool first = true;
+    while (readChunkHeader(chunk)) {
+        const qint64 payload = static_cast<qint64>(chunk.count) * sizeof(SessionRecord);
+        if (m_file.size() - m_file.pos() < payload) {
+            ++m_damaged;  // Niepelny ostatni fragment
+            break;
+        }
+        m_file.seek(m_file.pos() + payload);
+
+        if (first) m_firstNs = chunk.firstNs;
+        first = false;
+        m_lastNs = chunk.lastNs;
+        m_sampleCount += chunk.count;
+    }
+
+    rewind();
+    return true;
+}
+
+// Zamkniecie pliku
+void SessionFile::close()
+{
+    m_file.close();
+    m_sampleCount = 0;
+    m_firstNs = m_lastNs = 0;
+    m_damaged = 0;
+}
+
+// Powrot do pierwszego fragmentu
+void SessionFile::rewind()
+{
+    m_file.seek(sizeof(SessionFileHeader));
+}
+
+// Odczyt naglowka fragmentu
+bool SessionFile::readChunkHeader(SessionChunkHeader &header)
+{
+    const qint64 read = m_file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (read == 0) return false;  // Koniec pliku
+
+    if (read != sizeof(header) || header.magic != kSessionChunkMagic || header.count == 0) {
+        ++m_damaged;
+        return false;
+    }
+    return true;
+}
+
+// Odczyt kolejnego fragmentu z weryfikacja CRC
+bool SessionFile::nextChunk(std::vector<SessionRecord> &records)
+{
+    SessionChunkHeader header;
+    while (readChunkHeader(header)) {
+        records.resize(header.count);
+        const qint64 payload = static_cast<qint64>(header.count) * sizeof(SessionRecord);
+        char *data = reinterpret_cast<char *>(records.data());
+        if (m_file.read(data, payload) != payload) {
+            ++m_damaged;  // Niepelny ostatni fragment
+            break;
+        }
+        if (crc16(reinterpret_cast<const uint8_t *>(data), static_cast<std::size_t>(payload)) == header.crc)
+            return true;
+
+        // Uszkodzony fragment pomijany - dlugosc z naglowka wskazuje nastepny
+        ++m_damaged;
+    }
+    records.clear();
+    return false;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file    SessionFile.h
+ * @brief   Sequential reader for recorded session files
+ *
+ * @details Reads files written by SessionWriter chunk by chunk:
+ *          - Validates the file header and every chunk CRC; a damaged
+ *            chunk is skipped, the following ones are still read
+ *          - Stops cleanly at a truncated last chunk
+ *          - Memory use is bounded by one chunk
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SESSIONFILE_H
+#define SESSIONFILE_H
+
+#include <QFile>
+#include <QString>
+#include <vector>
+
+#include "SessionFormat.h"
+
+/**
+ * @class SessionFile
+ * @brief Chunk-wise access to a session file
+ */
+class SessionFile
+{
+public:
+    /**
+     * @brief Opens a session file and scans its chunk headers
+     * @param path File to open
+     * @param error Receives the error description on failure (optional)
+     * @return true if the file header is valid
+     *
+     * @details The scan only reads chunk headers, so opening long sessions
+     *          is fast. It determines the sample count and time span.
+     */
+    bool open(const QString &path, QString *error = nullptr);
+
+    /**
+     * @brief Closes the file
+     */
+    void close();
+
+    /**
+     * @brief True while a file is open
+     */
+    bool isOpen() const { return m_file.isOpen(); }
+
+    /**
+     * @brief Moves back to the first chunk
+     */
+    void rewind();
+
+    /**
+     * @brief Reads the next intact chunk
+     * @param records Receives the records of the chunk (reuses its storage)
+     * @return false at the end of the file, at a truncated last chunk or at
+     *         an unreadable chunk header
+     *
+     * @details A chunk whose payload fails the CRC check is counted in
+     *          damagedChunks() and skipped, so one damaged chunk does not
+     *          end the session.
+     */
+    bool nextChunk(std::vector<SessionRecord> &records);
+
+    /**
+     * @brief Number of samples in all complete chunks
+     */
+    quint64 sampleCount() const { return m_sampleCount; }
+
+    /**
+     * @brief Timestamp of the first sample (ns)
+     */
+    qint64 firstTimestamp() const { return m_firstNs; }
+
+    /**
+     * @brief Timestamp of the last sample (ns)
+     */
+    qint64 lastTimestamp() const { return m_lastNs; }
+
+    /**
+     * @brief Chunks rejected by the last scan or read (damaged or truncated)
+     */
+    int damagedChunks() const { return m_damaged; }
+
+private:
+    /**
+     * @brief Reads and checks one chunk header at the current position
+     */
+    bool readChunkHeader(SessionChunkHeader &header);
+
+    QFile m_file;                 ///< Session file
+    quint64 m_sampleCount = 0;    ///< Samples in complete chunks
+    qint64 m_firstNs = 0;         ///< First sample timestamp
+    qint64 m_lastNs = 0;          ///< Last sample timestamp
+    int m_damaged = 0;            ///< Rejected chunks
+};
+
+#endif // SESSIONFILE_H
@@ -0,0 +1,101 @@
+/**
+ * @file    SessionFormat.h
+ * @brief   On-disk layout of recorded platform sessions
+ *
+ * @details A session file is a file header followed by chunks:
+ *          @code
+ *          SessionFileHeader
+ *          SessionChunkHeader  SessionRecord[count]
+ *          SessionChunkHeader  SessionRecord[count]
+ *          ...
+ *          @endcode
+ *          Every chunk is self-describing and protected by a CRC, so a file
+ *          cut short by a crash is readable up to the last complete chunk.
+ *          All integers are little-endian.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SESSIONFORMAT_H
+#define SESSIONFORMAT_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "PlatformSample.h"
+
+inline constexpr char kSessionMagic[8] = { 'W', 'D', 'S', 'S', 'E', 'S', 'S', '1' }; ///< File signature
+inline constexpr uint32_t kSessionVersion = 1;          ///< Format version
+inline constexpr uint32_t kSessionChunkMagic = 0x4B4E4843; ///< "CHNK"
+
+/**
+ * @struct SessionFileHeader
+ * @brief Identifies a session file
+ */
+struct SessionFileHeader {
+    char magic[8];        ///< kSessionMagic
+    uint32_t version;     ///< kSessionVersion
+    uint32_t recordSize;  ///< sizeof(SessionRecord)
+    int64_t startNs;      ///< Host monotonic time when recording started
+};
+
+/**
+ * @struct SessionChunkHeader
+ * @brief Precedes every block of records
+ */
+struct SessionChunkHeader {
+    uint32_t magic;       ///< kSessionChunkMagic
+    uint32_t count;       ///< Number of records in the chunk
+    int64_t firstNs;      ///< Timestamp of the first record
+    int64_t lastNs;       ///< Timestamp of the last record
+    uint16_t crc;         ///< CRC-16 of the record payload
+    uint16_t reserved;    ///< Zero
+    uint32_t sequence;    ///< Chunk number, starting at 0
+};
+
+/**
+ * @struct SessionRecord
+ * @brief One recorded sample
+ */
+struct SessionRecord {
+    int64_t timestampNs;  ///< Host monotonic time of arrival
+    uint8_t type;         ///< PlatformSample::Type
+    uint8_t reserved;     ///< Zero
+    uint16_t imuId;       ///< IMU identifier (IMU samples only)
+    int16_t values[6];    ///< Raw field values
+};
+
+static_assert(sizeof(SessionFileHeader) == 24, "Unexpected session header layout");
+static_assert(sizeof(SessionChunkHeader) == 32, "Unexpected chunk header layout");
+static_assert(sizeof(SessionRecord) == 24, "Unexpected session record layout");
+
+/**
+ * @brief Converts a sample to its recorded form
+ */
+inline SessionRecord toSessionRecord(const PlatformSample &sample)
+{
+    SessionRecord record;
+    record.timestampNs = sample.timestampNs;
+    record.type = static_cast<uint8_t>(sample.type);
+    record.reserved = 0;
+    record.imuId = static_cast<uint16_t>(sample.imuId);
+    std::memcpy(record.values, sample.values, sizeof(record.values));
+    return record;
+}
+
+/**
+ * @brief Converts a recorded sample back to a PlatformSample
+ */
+inline PlatformSample fromSessionRecord(const SessionRecord &record)
+{
+    PlatformSample sample;
+    sample.timestampNs = record.timestampNs;
+    sample.type = static_cast<PlatformSample::Type>(record.type);
+    sample.imuId = record.imuId;
+    std::memcpy(sample.values, record.values, sizeof(sample.values));
+    return sample;
+}
+
+#endif // SESSIONFORMAT_H
@@ -0,0 +1,195 @@
+#include "SessionRecorder.h"
+#include <QDebug>
+#include <QFile>
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+constexpr auto kDrainInterval = std::chrono::milliseconds(20);  // Okres scalania kolejek czytnikow
+
+} // namespace
+
+// Konstruktor - blok fragmentu alokowany jednorazowo
+SessionRecorder::SessionRecorder(std::size_t recordsPerChunk)
+    : m_blockSize(qMax<std::size_t>(recordsPerChunk, 1))
+{
+    m_block.reserve(m_blockSize);
+}
+
+// Destruktor - zapis pozostalych danych
+SessionRecorder::~SessionRecorder()
+{
+    stop();
+}
+
+// Rejestracja czytnika (kolejka wejsciowa wlasnoscia rejestratora)
+SessionRecorder::Input *SessionRecorder::addInput(const std::atomic<int64_t> *busySinceNs, std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_inputs.push_back(std::unique_ptr<Input>(new Input(capacity, m_recording)));
+    Input *input = m_inputs.back().get();
+    m_merger.addSource(&input->m_queue, busySinceNs);
+    return input;
+}
+
+// Wyrejestrowanie czytnika po zatrzymaniu jego watku
+void SessionRecorder::removeInput(Input *input)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Probki pozostale w kolejce czytnika trafiaja jeszcze do pliku, w kolejnosci czasu z innymi portami
+    if (m_active)
+        m_merger.drainSource(&input->m_queue, [this](const PlatformSample &sample) { append(sample); });
+
+    m_removedDropped += input->droppedSamples();
+    m_merger.removeSource(&input->m_queue);
+    m_inputs.erase(std::remove_if(m_inputs.begin(), m_inputs.end(),
+                                  [input](const std::unique_ptr<Input> &entry) { return entry.get() == input; }),
+                   m_inputs.end());
+}
+
+// Rozpoczecie nagrywania do nowego pliku
+bool SessionRecorder::start(const QString &path, QString *error)
+{
+    stop();
+
+    // Watek zapisu zatrzymany - plik otwierany bez blokady
+    const int64_t startNs = monotonicNowNs();
+    if (!m_output.open(QFile::encodeName(path).constData(), startNs)) {
+        if (error) *error = QString::fromLocal8Bit(m_output.errorString());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_path = path;
+    m_startNs = startNs;
+    m_block.clear();
+    m_failed = false;
+    m_stopping = false;
+    m_active = true;
+    m_recorded.store(0, std::memory_order_relaxed);
+
+    // Liczniki strat od poczatku tego nagrania
+    m_removedDropped = 0;
+    for (const std::unique_ptr<Input> &input : m_inputs)
+        input->m_dropped.store(0, std::memory_order_relaxed);
+
+    m_recording.store(true, std::memory_order_release);
+    m_writer = std::thread(&SessionRecorder::writerLoop, this);
+    return true;
+}
+
+// Zakonczenie nagrywania
+void SessionRecorder::stop()
+{
+    if (!isRecording()) return;
+
+    // Czytniki przestaja oddawac probki; watek zapisu oproznia kolejki i konczy
+    m_recording.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    m_writer.join();
+
+    // Watek zapisu zakonczony - plik nie jest juz wspoldzielony
+    m_output.close();
+}
+
+// Straty wszystkich wejsc od poczatku nagrania
+quint64 SessionRecorder::droppedSamples() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    quint64 dropped = m_removedDropped;
+    for (const std::unique_ptr<Input> &input : m_inputs)
+        dropped += input->droppedSamples();
+    return dropped;
+}
+
+// Petla watku zapisu - scalanie kolejek co kDrainInterval
+void SessionRecorder::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        const bool stopping = m_stopping;
+        collect(stopping);
+
+        // Brak nowych probek (zatrzymany strumien, zamkniety port) - blok nie czeka do stop()
+        if (stopping || (!m_block.empty() && monotonicNowNs() - m_block.front().timestampNs >= flushInterval()))
+            sealBlock();
+        if (stopping)
+            m_active = false;
+
+        if (!m_sealed.empty()) {
+            // Zapis poza blokada - addInput()/removeInput() nie czekaja na dysk
+            m_writing.swap(m_sealed);
+            if (!m_failed) {
+                lock.unlock();
+                const bool written = writeBlocks(m_writing);
+                lock.lock();
+                if (!written) m_failed = true;  // Dalsze probki tylko odrzucane
+            }
+            for (Block &block : m_writing) {
+                block.clear();
+                m_spare.push_back(std::move(block));
+            }
+            m_writing.clear();
+        }
+
+        if (stopping) break;
+        m_wake.wait_for(lock, kDrainInterval, [this]() { return m_stopping; });
+    }
+}
+
+// Probki zwolnione przez scalanie (kolejnosc czasowa miedzy portami)
+void SessionRecorder::collect(bool all)
+{
+    m_merger.drain([this](const PlatformSample &sample) { append(sample); }, all);
+}
+
+// Dopisanie probki do bloku
+void SessionRecorder::append(const PlatformSample &sample)
+{
+    // Resztki poprzedniego nagrania lub plik po bledzie zapisu
+    if (sample.timestampNs < m_startNs || m_failed) return;
+
+    m_block.push_back(toSessionRecord(sample));
+
+    // Pelny blok lub zbyt dlugo czekajace probki - blok do zapisu
+    if (m_block.size() == m_blockSize
+        || sample.timestampNs - m_block.front().timestampNs >= flushInterval()) {
+        sealBlock();
+    }
+}
+
+// Przekazanie bloku do zapisu i nowy blok (bufory wielokrotnego uzytku)
+void SessionRecorder::sealBlock()
+{
+    if (m_block.empty()) return;
+
+    m_sealed.push_back(std::move(m_block));
+    if (m_spare.empty()) {
+        m_block = Block();
+        m_block.reserve(m_blockSize);
+    } else {
+        m_block = std::move(m_spare.back());
+        m_spare.pop_back();
+    }
+}
+
+// Zapis blokow jako fragmentow pliku
+bool SessionRecorder::writeBlocks(const std::vector<Block> &blocks)
+{
+    for (const Block &block : blocks) {
+        // Fragment trafia do systemu operacyjnego od razu - awaria traci najwyzej jeden blok
+        if (!m_output.writeChunk(block.data(), block.size())) {
+            qWarning() << "Session recording failed:" << m_output.errorString();
+            return false;
+        }
+        m_recorded.fetch_add(block.size(), std::memory_order_relaxed);
+    }
+    return true;
+}
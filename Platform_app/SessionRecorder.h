@@ -0,0 +1,219 @@
+/**
+ * @file    SessionRecorder.h
+ * @brief   Append-only binary recorder for decoded samples
+ *
+ * @details Persists every validated sample in the chunked format described
+ *          in SessionFormat.h:
+ *          - Each serial reader hands samples to its own lock-free input
+ *            queue, before (and independently of) the GUI queue
+ *          - A background thread merges the inputs by timestamp and writes
+ *            the chunks, so the file is in time order for all ports
+ *          - Disk stalls drop samples instead of blocking the readers
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SESSIONRECORDER_H
+#define SESSIONRECORDER_H
+
+#include <QString>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "PlatformSample.h"
+#include "SampleMerger.h"
+#include "SessionFormat.h"
+#include "SessionWriter.h"
+#include "SpscQueue.h"
+
+/**
+ * @class SessionRecorder
+ * @brief Records the samples of all readers to one session file without
+ *        blocking them
+ *
+ * @details addInput(), removeInput(), start() and stop() are called from
+ *          the GUI thread; Input::record() from the thread of the reader
+ *          owning the input. The writer thread merges the input queues with
+ *          a SampleMerger using the readers' batch state, so samples reach
+ *          the file in timestamp order even if the GUI falls behind. A
+ *          block becomes a chunk on disk when it is full or older than
+ *          flushInterval(), which bounds the data lost by a crash to one
+ *          chunk. Chunks are written with the lock released, so the GUI
+ *          thread never waits for the disk.
+ */
+class SessionRecorder
+{
+public:
+    /**
+     * @class Input
+     * @brief Per-reader entry point of the recorder
+     */
+    class Input
+    {
+    public:
+        /**
+         * @brief Hands a sample to the recorder (reader thread)
+         * @param sample Validated sample with its host timestamp
+         *
+         * @details Never blocks and never allocates. Does nothing while the
+         *          recorder is stopped; samples are dropped (and counted)
+         *          when the writer cannot keep up.
+         */
+        void record(const PlatformSample &sample)
+        {
+            if (!m_recording.load(std::memory_order_relaxed)) return;
+            if (!m_queue.tryPush(sample))
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Samples of this input dropped on a full queue. Thread-safe.
+         */
+        quint64 droppedSamples() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        friend class SessionRecorder;
+
+        Input(std::size_t capacity, const std::atomic<bool> &recording)
+            : m_queue(capacity), m_recording(recording) {}
+
+        SpscQueue<PlatformSample> m_queue;      ///< Samples waiting for the writer (reader -> writer)
+        const std::atomic<bool> &m_recording;   ///< Recorder state
+        std::atomic<quint64> m_dropped{0};      ///< Samples lost to a full queue
+    };
+
+    /**
+     * @brief Constructs an idle recorder
+     * @param recordsPerChunk Samples per chunk
+     */
+    explicit SessionRecorder(std::size_t recordsPerChunk = 4096);
+
+    /**
+     * @brief Stops recording and flushes pending data
+     */
+    ~SessionRecorder();
+
+    SessionRecorder(const SessionRecorder&) = delete;
+    SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+    /**
+     * @brief Registers a reader
+     * @param busySinceNs Batch state of the reader (see SampleMerger)
+     * @param capacity Samples buffered for the writer
+     * @return Input to pass to the reader, owned by the recorder until
+     *         removeInput()
+     *
+     * @details Can be called while recording.
+     */
+    Input *addInput(const std::atomic<int64_t> *busySinceNs, std::size_t capacity = 65536);
+
+    /**
+     * @brief Unregisters a reader after its thread stopped
+     *
+     * @details Samples still queued in the input are recorded first.
+     */
+    void removeInput(Input *input);
+
+    /**
+     * @brief Opens a new session file and starts the writer thread
+     * @param path File to create (truncated if it exists)
+     * @param error Receives the error description on failure (optional)
+     * @return true on success
+     */
+    bool start(const QString &path, QString *error = nullptr);
+
+    /**
+     * @brief Writes the remaining samples and closes the file
+     */
+    void stop();
+
+    /**
+     * @brief True between start() and stop()
+     */
+    bool isRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Path of the current or last session file
+     */
+    const QString &path() const { return m_path; }
+
+    /**
+     * @brief Samples written to the session. Thread-safe.
+     */
+    quint64 recordedSamples() const { return m_recorded.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Samples dropped by all inputs, including removed ones
+     */
+    quint64 droppedSamples() const;
+
+    /**
+     * @brief Maximum time a sample waits in a partially filled block (ns)
+     *
+     * @details Checked on every sample and on every writer wake-up, so the
+     *          limit also holds after the stream stalls.
+     */
+    static constexpr int64_t flushInterval() { return 1000000000; }
+
+private:
+    using Block = std::vector<SessionRecord>;     ///< Records of one chunk
+
+    /**
+     * @brief Writer thread main loop
+     */
+    void writerLoop();
+
+    /**
+     * @brief Moves the samples the merger releases into the block (m_mutex held)
+     * @param all true to also take samples the merger would hold back
+     */
+    void collect(bool all);
+
+    /**
+     * @brief Appends one sample to the block, sealing it when full (m_mutex held)
+     */
+    void append(const PlatformSample &sample);
+
+    /**
+     * @brief Queues the block for writing and starts a new one (m_mutex held)
+     */
+    void sealBlock();
+
+    /**
+     * @brief Writes the sealed blocks as chunks (writer thread, m_mutex released)
+     * @param blocks Blocks to write, in order
+     * @return false on a write error
+     */
+    bool writeBlocks(const std::vector<Block> &blocks);
+
+    std::vector<std::unique_ptr<Input>> m_inputs; ///< Registered readers
+    SampleMerger m_merger;                        ///< Timestamp merge of the input queues
+    Block m_block;                                ///< Records of the next chunk
+    std::vector<Block> m_sealed;                  ///< Blocks waiting to be written
+    std::vector<Block> m_writing;                 ///< Blocks being written (writer thread)
+    std::vector<Block> m_spare;                   ///< Written blocks reused as m_block
+    std::size_t m_blockSize;                      ///< Records per chunk
+
+    std::thread m_writer;                         ///< Background writer
+    mutable std::mutex m_mutex;                   ///< Protects the inputs, merger and blocks; never held during I/O
+    std::condition_variable m_wake;               ///< Wakes the writer on stop()
+    bool m_stopping = false;                      ///< Writer should drain and exit (m_mutex)
+    bool m_active = false;                        ///< Writer thread collects samples (m_mutex)
+
+    SessionWriter m_output;                       ///< Output file (writer thread while recording)
+    bool m_failed = false;                        ///< Write error reported, further samples discarded (m_mutex)
+
+    QString m_path;                               ///< Session file path
+    std::atomic<bool> m_recording{false};         ///< Inputs accept samples
+    int64_t m_startNs = 0;                        ///< Samples before this time are stale leftovers
+    std::atomic<quint64> m_recorded{0};           ///< Samples written
+    quint64 m_removedDropped = 0;                 ///< Drops of removed inputs
+};
+
+#endif // SESSIONRECORDER_H
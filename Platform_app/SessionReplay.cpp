@@ -0,0 +1,198 @@
+#include "SessionReplay.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+constexpr int kTickMs = 4;                      // Okres zegara odtwarzania
+constexpr qint64 kFastBudgetNs = 8000000;       // Czas przetwarzania na iteracje w trybie szybkim
+constexpr qint64 kReportIntervalNs = 250000000; // Okres raportowania postepu
+
+} // namespace
+
+// Konstruktor odtwarzacza sesji
+SessionReplay::SessionReplay(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, &QTimer::timeout, this, &SessionReplay::onTick);
+}
+
+// Otwarcie pliku sesji
+bool SessionReplay::open(const QString &path, QString *error)
+{
+    stop();
+    if (!m_file.open(path, error))
+        return false;
+
+    m_chunk.clear();
+    m_index = 0;
+    m_positionNs = m_file.firstTimestamp();
+    m_startNs = 0;
+    m_delivered = 0;
+    return true;
+}
+
+// Start lub wznowienie odtwarzania
+void SessionReplay::play()
+{
+    if (!m_file.isOpen() || m_timer.isActive()) return;
+
+    const qint64 now = monotonicNowNs();
+    if (m_startNs == 0) {
+        m_startNs = now;
+        m_reportNs = now;
+        m_reportDelivered = 0;
+    }
+
+    rebase();
+    m_timer.start(m_fast ? 0 : kTickMs);
+}
+
+// Wstrzymanie odtwarzania
+void SessionReplay::pause()
+{
+    m_timer.stop();
+}
+
+// Zatrzymanie i zamkniecie sesji
+void SessionReplay::stop()
+{
+    m_timer.stop();
+    m_file.close();
+    m_chunk.clear();
+    m_index = 0;
+}
+
+// Zmiana predkosci odtwarzania
+void SessionReplay::setSpeed(double factor)
+{
+    m_speed = qBound(1.0, factor, 100.0);
+    rebase();
+}
+
+// Tryb "najszybciej jak to mozliwe"
+void SessionReplay::setFastMode(bool enabled)
+{
+    m_fast = enabled;
+    rebase();
+
+    // Licznik przepustowosci od nowa
+    m_reportNs = monotonicNowNs();
+    m_reportDelivered = m_delivered;
+
+    if (m_timer.isActive())
+        m_timer.start(m_fast ? 0 : kTickMs);
+}
+
+// Powiazanie czasu sesji z zegarem komputera
+void SessionReplay::rebase()
+{
+    m_hostRefNs = monotonicNowNs();
+    m_sessionRefNs = m_positionNs;
+}
+
+// Dostepnosc kolejnego rekordu
+bool SessionReplay::ensureRecord()
+{
+    if (m_index < m_chunk.size()) return true;
+
+    m_index = 0;
+    if (!m_file.nextChunk(m_chunk)) return false;
+    convertChunk();
+    return true;
+}
+
+// Przeliczenie calego fragmentu na jednostki SI
+void SessionReplay::convertChunk()
+{
+    if (!m_converter) return;
+    m_scaled.resize(m_chunk.size() * 6);
+
+    const uint8_t imuType = static_cast<uint8_t>(PlatformSample::Type::Imu);
+    const std::size_t stride = sizeof(SessionRecord) / sizeof(int16_t);
+
+    // Kernel pierwszego IMU dla wszystkich rekordow jednym wywolaniem
+    auto first = std::find_if(m_chunk.begin(), m_chunk.end(),
+                              [imuType](const SessionRecord &record) { return record.type == imuType; });
+    if (first == m_chunk.end()) return;
+    const ImuConverter common = m_converter(first->imuId);
+    common(m_chunk.front().values, stride, m_scaled.data(), m_chunk.size());
+
+    // IMU o innym zakresie - ponowne przeliczenie ich rekordow
+    int32_t lastId = first->imuId;
+    ImuConverter converter = common;
+    for (std::size_t i = 0; i < m_chunk.size(); ++i) {
+        const SessionRecord &record = m_chunk[i];
+        if (record.type != imuType) continue;
+        if (record.imuId != lastId) {
+            lastId = record.imuId;
+            converter = m_converter(lastId);
+        }
+        if (converter != common)
+            converter(record.values, stride, &m_scaled[i * 6], 1);
+    }
+}
+
+// Takt odtwarzania
+void SessionReplay::onTick()
+{
+    const qint64 now = monotonicNowNs();
+
+    // Czas sesji, do ktorego nalezy dostarczyc probki
+    const qint64 target = m_fast ? std::numeric_limits<qint64>::max()
+                                 : m_sessionRefNs + static_cast<qint64>((now - m_hostRefNs) * m_speed);
+    const qint64 deadline = now + kFastBudgetNs;
+
+    int sinceCheck = 0;
+    while (ensureRecord()) {
+        const SessionRecord &record = m_chunk[m_index];
+        if (record.timestampNs > target) break;
+
+        // Znacznik czasu przeniesiony na zegar komputera (jak przy odczycie z portu)
+        PlatformSample sample = fromSessionRecord(record);
+        sample.timestampNs = m_fast ? monotonicNowNs()
+                                    : m_hostRefNs + static_cast<qint64>((record.timestampNs - m_sessionRefNs) / m_speed);
+        const float *scaled = (m_converter && record.type == static_cast<uint8_t>(PlatformSample::Type::Imu))
+                                  ? &m_scaled[m_index * 6] : nullptr;
+        m_positionNs = record.timestampNs;
+        ++m_index;
+        ++m_delivered;
+
+        if (m_sink) m_sink(sample, scaled);
+
+        // Tryb szybki - oddanie sterowania petli zdarzen po wyczerpaniu budzetu
+        if (m_fast && ++sinceCheck == 256) {
+            sinceCheck = 0;
+            if (monotonicNowNs() >= deadline) {
+                report(monotonicNowNs(), false);
+                return;
+            }
+        }
+    }
+
+    if (!ensureRecord()) {
+        m_timer.stop();
+        const qint64 end = monotonicNowNs();
+        report(end, true);
+        emit finished(m_delivered, (end - m_startNs) * 1e-9);
+        return;
+    }
+
+    report(now, false);
+}
+
+// Raport postepu i przepustowosci
+void SessionReplay::report(qint64 nowNs, bool force)
+{
+    if (!force && nowNs - m_reportNs < kReportIntervalNs) return;
+
+    emit progress((m_positionNs - m_file.firstTimestamp()) * 1e-9, duration());
+
+    if (m_fast && nowNs > m_reportNs) {
+        emit throughput((m_delivered - m_reportDelivered) * 1e9 / (nowNs - m_reportNs));
+    }
+
+    m_reportNs = nowNs;
+    m_reportDelivered = m_delivered;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file    SessionReplay.h
+ * @brief   Plays recorded sessions back through the visualization path
+ *
+ * @details Feeds samples from a session file to the same consumer as the
+ *          serial reader:
+ *          - Real-time playback at 1x-100x speed with pause
+ *          - As-fast-as-possible mode reporting absorbed samples per second
+ *          - Timestamps are remapped to the host clock, so plots behave
+ *            exactly as with live data
+ *          - IMU records are converted to SI units a whole chunk at a time
+ *            with the strided conversion kernel
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SESSIONREPLAY_H
+#define SESSIONREPLAY_H
+
+#include <QObject>
+#include <QTimer>
+#include <functional>
+#include <vector>
+
+#include "ImuConversion.h"
+#include "PlatformSample.h"
+#include "SessionFile.h"
+
+/**
+ * @class SessionReplay
+ * @brief Timer-driven session player running on the GUI thread
+ *
+ * @details Samples are delivered to the sink set with setSink(). In fast
+ *          mode the player processes samples for a few milliseconds per
+ *          event loop iteration and then yields, so display frames keep
+ *          being rendered and are included in the measured throughput.
+ */
+class SessionReplay : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Receives replayed samples
+     *
+     * The second argument points to the 6 SI values of an IMU sample
+     * (see ImuBank::store()), or is nullptr for other samples and when no
+     * converter is set.
+     */
+    using Sink = std::function<void(const PlatformSample &, const float *)>;
+
+    /**
+     * @brief Returns the conversion kernel of an IMU id (see ImuBank::converter())
+     */
+    using ConverterLookup = std::function<ImuConverter(int32_t)>;
+
+    /**
+     * @brief Constructs an idle player
+     * @param parent Parent object (default: nullptr)
+     */
+    explicit SessionReplay(QObject *parent = nullptr);
+
+    /**
+     * @brief Sets the consumer of replayed samples
+     */
+    void setSink(Sink sink) { m_sink = std::move(sink); }
+
+    /**
+     * @brief Enables chunk-wise conversion of IMU records
+     * @param lookup Kernel of each IMU id; empty to deliver raw samples only
+     *
+     * Call before open(); kernels are looked up when a chunk is loaded.
+     */
+    void setConverter(ConverterLookup lookup) { m_converter = std::move(lookup); }
+
+    /**
+     * @brief Opens a session file and rewinds to its start
+     * @param path Session file written by SessionRecorder
+     * @param error Receives the error description on failure (optional)
+     * @return true on success
+     */
+    bool open(const QString &path, QString *error = nullptr);
+
+    /**
+     * @brief Starts or resumes playback
+     */
+    void play();
+
+    /**
+     * @brief Pauses playback at the current position
+     */
+    void pause();
+
+    /**
+     * @brief Stops playback and closes the file
+     */
+    void stop();
+
+    /**
+     * @brief Sets the playback speed
+     * @param factor Speed multiplier, clamped to 1-100
+     */
+    void setSpeed(double factor);
+
+    /**
+     * @brief Enables the as-fast-as-possible mode
+     * @param enabled true to ignore recorded timing
+     */
+    void setFastMode(bool enabled);
+
+    /**
+     * @brief True while samples are being delivered
+     */
+    bool isPlaying() const { return m_timer.isActive(); }
+
+    /**
+     * @brief True while a session is open
+     */
+    bool isOpen() const { return m_file.isOpen(); }
+
+    /**
+     * @brief Total number of samples in the session
+     */
+    quint64 sampleCount() const { return m_file.sampleCount(); }
+
+    /**
+     * @brief Recorded duration of the session in seconds
+     */
+    double duration() const { return (m_file.lastTimestamp() - m_file.firstTimestamp()) * 1e-9; }
+
+signals:
+    /**
+     * @brief Playback position changed (emitted a few times per second)
+     * @param position Session time of the last delivered sample (s)
+     * @param duration Session duration (s)
+     */
+    void progress(double position, double duration);
+
+    /**
+     * @brief Throughput of the whole pipeline in fast mode
+     * @param samplesPerSecond Samples delivered and processed per wall-clock second
+     */
+    void throughput(double samplesPerSecond);
+
+    /**
+     * @brief The last sample of the session was delivered
+     * @param samples Samples delivered since play() was first called
+     * @param seconds Wall-clock time of the playback
+     */
+    void finished(quint64 samples, double seconds);
+
+private slots:
+    /**
+     * @brief Delivers the samples due at this tick
+     */
+    void onTick();
+
+private:
+    /**
+     * @brief Makes the next record available
+     * @return false at the end of the session
+     */
+    bool ensureRecord();
+
+    /**
+     * @brief Converts the IMU records of m_chunk into m_scaled
+     *
+     * @details One kernel call covers the whole chunk (servo records are
+     *          converted too and ignored); only IMUs with a range other
+     *          than that of the first IMU record are converted again.
+     */
+    void convertChunk();
+
+    /**
+     * @brief Re-anchors session time to the host clock (speed change, resume)
+     */
+    void rebase();
+
+    /**
+     * @brief Emits progress() and, in fast mode, throughput() if due
+     */
+    void report(qint64 nowNs, bool force);
+
+    SessionFile m_file;                     ///< Open session
+    std::vector<SessionRecord> m_chunk;     ///< Current chunk
+    std::vector<float> m_scaled;            ///< SI values of m_chunk, 6 per record
+    std::size_t m_index = 0;                ///< Next record in m_chunk
+    Sink m_sink;                            ///< Sample consumer
+    ConverterLookup m_converter;            ///< Conversion kernel per IMU id
+    QTimer m_timer;                         ///< Playback clock
+
+    double m_speed = 1.0;                   ///< Speed multiplier
+    bool m_fast = false;                    ///< As-fast-as-possible mode
+    qint64 m_hostRefNs = 0;                 ///< Host time matching m_sessionRefNs
+    qint64 m_sessionRefNs = 0;              ///< Session time at m_hostRefNs
+    qint64 m_positionNs = 0;                ///< Session time of the last delivered sample
+
+    qint64 m_startNs = 0;                   ///< Host time of the first play()
+    quint64 m_delivered = 0;                ///< Samples delivered since the first play()
+    qint64 m_reportNs = 0;                  ///< Host time of the last report
+    quint64 m_reportDelivered = 0;          ///< m_delivered at the last report
+};
+
+#endif // SESSIONREPLAY_H
@@ -0,0 +1,97 @@
+#include "SessionWriter.h"
+#include "Crc16.h"
+#include <cerrno>
+#include <cstring>
+
+// Destruktor - zamkniecie pliku
+SessionWriter::~SessionWriter()
+{
+    close();
+}
+
+// Utworzenie pliku sesji
+bool SessionWriter::open(const char *path, int64_t startNs)
+{
+    close();
+    m_file = std::fopen(path, "wb");
+    if (!m_file) {
+        m_errno = errno;
+        return false;
+    }
+    m_owned = true;
+    return writeHeader(startNs);
+}
+
+// Sesja do otwartego strumienia (np. stdout)
+bool SessionWriter::open(std::FILE *stream, int64_t startNs)
+{
+    close();
+    m_file = stream;
+    m_owned = false;
+    return writeHeader(startNs);
+}
+
+// Zamkniecie pliku (cudzy strumien tylko oprozniany)
+void SessionWriter::close()
+{
+    if (!m_file) return;
+    if (m_owned) std::fclose(m_file);
+    else std::fflush(m_file);
+    m_file = nullptr;
+    m_owned = false;
+}
+
+// Naglowek pliku
+bool SessionWriter::writeHeader(int64_t startNs)
+{
+    SessionFileHeader header;
+    std::memcpy(header.magic, kSessionMagic, sizeof(header.magic));
+    header.version = kSessionVersion;
+    header.recordSize = sizeof(SessionRecord);
+    header.startNs = startNs;
+
+    m_sequence = 0;
+    m_errno = 0;
+    if (std::fwrite(&header, sizeof(header), 1, m_file) == 1 && std::fflush(m_file) == 0)
+        return true;
+
+    m_errno = errno;
+    close();
+    return false;
+}
+
+// Zapis rekordow jako jednego fragmentu
+bool SessionWriter::writeChunk(const SessionRecord *records, std::size_t count)
+{
+    if (!m_file) {
+        m_errno = EBADF;
+        return false;
+    }
+    if (count == 0) return true;
+
+    const std::size_t payloadSize = count * sizeof(SessionRecord);
+
+    SessionChunkHeader header;
+    header.magic = kSessionChunkMagic;
+    header.count = static_cast<uint32_t>(count);
+    header.firstNs = records[0].timestampNs;
+    header.lastNs = records[count - 1].timestampNs;
+    header.crc = crc16(reinterpret_cast<const uint8_t *>(records), payloadSize);
+    header.reserved = 0;
+    header.sequence = m_sequence++;
+
+    // Fragment trafia do systemu operacyjnego od razu - awaria traci najwyzej jeden fragment
+    if (std::fwrite(&header, sizeof(header), 1, m_file) == 1
+        && std::fwrite(records, payloadSize, 1, m_file) == 1
+        && std::fflush(m_file) == 0)
+        return true;
+
+    m_errno = errno;
+    return false;
+}
+
+// Opis ostatniego bledu
+const char *SessionWriter::errorString() const
+{
+    return std::strerror(m_errno);
+}
@@ -0,0 +1,107 @@
+/**
+ * @file    SessionWriter.h
+ * @brief   Qt-free writer for the session file format
+ *
+ * @details Serializes the file header and the CRC protected chunks
+ *          described in SessionFormat.h to a std::FILE:
+ *          - Used by SessionRecorder (GUI) and platform_ingest (headless),
+ *            so both produce byte-identical files
+ *          - Every chunk is flushed to the operating system when written,
+ *            so a crash loses at most the chunk being assembled
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SESSIONWRITER_H
+#define SESSIONWRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "SessionFormat.h"
+
+/**
+ * @class SessionWriter
+ * @brief Writes one session file chunk by chunk
+ *
+ * @details Not thread-safe; the owner serializes the calls. Records of one
+ *          chunk must be in time order, as the chunk header stores the
+ *          first and last timestamp.
+ *
+ * Typical use:
+ * @code
+ * SessionWriter writer;
+ * if (!writer.open(path, monotonicNowNs())) report(writer.errorString());
+ * writer.writeChunk(block.data(), block.size());
+ * writer.close();
+ * @endcode
+ */
+class SessionWriter
+{
+public:
+    SessionWriter() = default;
+    ~SessionWriter();
+
+    SessionWriter(const SessionWriter &) = delete;
+    SessionWriter &operator=(const SessionWriter &) = delete;
+
+    /**
+     * @brief Creates (truncates) a session file and writes its header
+     * @param path File to create, in the local 8-bit encoding
+     * @param startNs Recording start time stored in the header
+     * @return false if the file cannot be created or the header written
+     */
+    bool open(const char *path, int64_t startNs);
+
+    /**
+     * @brief Writes a session to an already open stream (e.g. stdout)
+     * @param stream Binary output stream, not closed by the writer
+     * @param startNs Recording start time stored in the header
+     * @return false if the header cannot be written
+     */
+    bool open(std::FILE *stream, int64_t startNs);
+
+    /**
+     * @brief Closes the file (a stream passed to open() is only flushed)
+     */
+    void close();
+
+    /**
+     * @brief True between a successful open() and close()
+     */
+    bool isOpen() const { return m_file != nullptr; }
+
+    /**
+     * @brief Writes @p count records as one chunk and flushes it
+     * @param records Records in time order
+     * @param count Number of records; 0 writes nothing
+     * @return false on a write error (see errorString())
+     */
+    bool writeChunk(const SessionRecord *records, std::size_t count);
+
+    /**
+     * @brief Description of the last open or write error
+     */
+    const char *errorString() const;
+
+    /**
+     * @brief Chunks written since open()
+     */
+    uint32_t chunkCount() const { return m_sequence; }
+
+private:
+    /**
+     * @brief Writes the file header (shared part of both open() overloads)
+     */
+    bool writeHeader(int64_t startNs);
+
+    std::FILE *m_file = nullptr;  ///< Output stream
+    bool m_owned = false;         ///< Stream opened (and closed) by the writer
+    uint32_t m_sequence = 0;      ///< Number of the next chunk
+    int m_errno = 0;              ///< errno of the last failure
+};
+
+#endif // SESSIONWRITER_H
@@ -0,0 +1,226 @@
+#include "SpectrumAnalyzer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+const std::size_t kQueueCapacity = 16384;   // ~250 ms przy 16 IMU po 4 kHz
+const auto kPollPeriod = std::chrono::milliseconds(5);
+const float kRateSmoothing = 0.2f;          // Waga nowego pomiaru czestotliwosci
+const float kFloorPower = 1e-16f;           // Dolna granica mocy (-160 dB)
+
+} // namespace
+
+// Konstruktor - rozmiar poprawiany do dozwolonego zakresu
+SpectrumAnalyzer::SpectrumAnalyzer(std::size_t size)
+    : m_queue(kQueueCapacity),
+      m_requestedSize(RealFft::isValidSize(size) && size >= kMinSize && size <= kMaxSize ? size : 1024)
+{
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    stop();
+}
+
+// Uruchomienie watku - tablice przygotowane przed startem, historia od zera
+void SpectrumAnalyzer::start()
+{
+    if (m_thread.joinable()) return;
+
+    configure(m_requestedSize.load(std::memory_order_relaxed));
+    m_resetRequested.store(false, std::memory_order_relaxed);
+    m_stopping = false;
+    m_thread = std::thread(&SpectrumAnalyzer::run, this);
+}
+
+// Zatrzymanie watku i odrzucenie nieprzetworzonych probek
+void SpectrumAnalyzer::stop()
+{
+    if (!m_thread.joinable()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+
+    // Watek zakonczony - ten watek przejmuje role konsumenta kolejki
+    Entry entry;
+    while (m_queue.tryPop(entry)) {
+    }
+}
+
+// Probka od producenta - nigdy nie blokuje
+bool SpectrumAnalyzer::push(int slot, const float *values, int64_t timestampNs)
+{
+    if (slot < 0 || slot >= kMaxImus) return false;
+
+    Entry entry;
+    entry.slot = slot;
+    std::copy(values, values + kAxes, entry.values);
+    entry.timestampNs = timestampNs;
+
+    if (!m_queue.tryPush(entry)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+// Nowy rozmiar - przejmowany przez watek roboczy przy nastepnym wybudzeniu
+void SpectrumAnalyzer::setSize(std::size_t size)
+{
+    if (!RealFft::isValidSize(size) || size < kMinSize || size > kMaxSize) return;
+    m_requestedSize.store(size, std::memory_order_relaxed);
+}
+
+void SpectrumAnalyzer::reset()
+{
+    m_resetRequested.store(true, std::memory_order_release);
+}
+
+// Kopia najnowszego widma jednej osi
+bool SpectrumAnalyzer::spectrum(int slot, int axis, std::vector<float> &out, uint64_t *frame, float *rateHz) const
+{
+    if (slot < 0 || slot >= kMaxImus || axis < 0 || axis >= kAxes) return false;
+
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    const Result &result = m_results[slot];
+    if (result.frame == 0) return false;
+
+    out.assign(result.decibels[axis].begin(), result.decibels[axis].end());
+    if (frame) *frame = result.frame;
+    if (rateHz) *rateHz = result.rateHz;
+    return true;
+}
+
+// Petla watku roboczego - odpytywanie kolejki co kPollPeriod
+void SpectrumAnalyzer::run()
+{
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    while (!m_stopping) {
+        lock.unlock();
+
+        const std::size_t size = m_requestedSize.load(std::memory_order_relaxed);
+        if (size != m_size || m_resetRequested.exchange(false, std::memory_order_acq_rel))
+            configure(size);
+
+        Entry entry;
+        while (m_queue.tryPop(entry))
+            process(entry);
+
+        lock.lock();
+        m_wake.wait_for(lock, kPollPeriod, [this]() { return m_stopping; });
+    }
+}
+
+// Okno Hanna, FFT i bufory dla nowego rozmiaru; historia i wyniki od zera
+void SpectrumAnalyzer::configure(std::size_t size)
+{
+    if (size != m_size) {
+        m_size = size;
+        m_fft.reset(new RealFft(size));
+
+        // Okno okresowe (N w mianowniku) - dokladne przy nakladaniu 50%
+        m_window.resize(size);
+        double sum = 0.0;
+        for (std::size_t i = 0; i < size; ++i) {
+            m_window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * kPi * i / size));
+            sum += m_window[i];
+        }
+        // |X|^2 -> dB amplitudy sinusa: 20 log10(2 |X| / sum(w))
+        m_decibelOffset = static_cast<float>(20.0 * std::log10(2.0 / sum));
+
+        m_frame.resize(size);
+        for (auto &decibels : m_decibels)
+            decibels.resize(m_fft->bins());
+        for (Channel &channel : m_channels) {
+            for (auto &history : channel.history)
+                history.assign(size, 0.0f);
+        }
+    }
+
+    for (Channel &channel : m_channels) {
+        channel.written = 0;
+        channel.hopStartNs = 0;
+        channel.rateHz = 0.0f;
+    }
+
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    for (Result &result : m_results) {
+        for (auto &decibels : result.decibels)
+            decibels.assign(m_fft->bins(), 0.0f);
+        result.frame = 0;
+        result.rateHz = 0.0f;
+    }
+}
+
+// Dopisanie probki do historii, analiza co pol okna
+void SpectrumAnalyzer::process(const Entry &entry)
+{
+    Channel &channel = m_channels[entry.slot];
+    const std::size_t hop = m_size / 2;
+
+    // Czestotliwosc probkowania z czasu trwania poprzedniego przesuniecia
+    if (channel.written % hop == 0) {
+        if (channel.written > 0 && entry.timestampNs > channel.hopStartNs) {
+            const float measured = hop * 1e9f / static_cast<float>(entry.timestampNs - channel.hopStartNs);
+            channel.rateHz = (channel.rateHz > 0.0f)
+                ? channel.rateHz + kRateSmoothing * (measured - channel.rateHz)
+                : measured;
+        }
+        channel.hopStartNs = entry.timestampNs;
+    }
+
+    const std::size_t position = channel.written & (m_size - 1);
+    for (int axis = 0; axis < kAxes; ++axis)
+        channel.history[axis][position] = entry.values[axis];
+    ++channel.written;
+
+    if (channel.written >= m_size && channel.written % hop == 0)
+        analyze(entry.slot, channel);
+}
+
+// Widma wszystkich osi jednego IMU
+void SpectrumAnalyzer::analyze(int slot, Channel &channel)
+{
+    const std::size_t mask = m_size - 1;
+    const std::size_t oldest = channel.written & mask;
+    const std::size_t bins = m_fft->bins();
+
+    for (int axis = 0; axis < kAxes; ++axis) {
+        const std::vector<float> &history = channel.history[axis];
+
+        // Usuniecie sredniej (grawitacja, bias zyroskopu) przed oknem
+        double sum = 0.0;
+        for (std::size_t i = 0; i < m_size; ++i)
+            sum += history[i];
+        const float mean = static_cast<float>(sum / m_size);
+
+        // Rozwiniecie pierscienia od najstarszej probki
+        const std::size_t tail = m_size - oldest;
+        for (std::size_t i = 0; i < tail; ++i)
+            m_frame[i] = (history[oldest + i] - mean) * m_window[i];
+        for (std::size_t i = tail; i < m_size; ++i)
+            m_frame[i] = (history[i - tail] - mean) * m_window[i];
+
+        const std::complex<float> *spectrum = m_fft->transform(m_frame.data());
+        std::vector<float> &decibels = m_decibels[axis];
+        for (std::size_t k = 0; k < bins; ++k) {
+            const float power = spectrum[k].real() * spectrum[k].real() + spectrum[k].imag() * spectrum[k].imag();
+            decibels[k] = 10.0f * std::log10(std::max(power, kFloorPower)) + m_decibelOffset;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_resultMutex);
+    Result &result = m_results[slot];
+    for (int axis = 0; axis < kAxes; ++axis)
+        std::copy(m_decibels[axis].begin(), m_decibels[axis].end(), result.decibels[axis].begin());
+    ++result.frame;
+    result.rateHz = channel.rateHz;
+}
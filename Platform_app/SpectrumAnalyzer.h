@@ -0,0 +1,199 @@
+/**
+ * @file    SpectrumAnalyzer.h
+ * @brief   Streaming vibration spectrum of every IMU axis
+ *
+ * @details Overlapping windowed FFT computed on a worker thread:
+ *          - Samples are handed over through a lock-free SPSC queue, the
+ *            producer never blocks
+ *          - Per IMU and axis a ring of the last N samples; every N/2 new
+ *            samples (50% overlap) the mean is removed, a precomputed Hann
+ *            window applied and one RealFft executed
+ *          - Window, twiddles and all buffers are allocated when the size
+ *            is set, never per sample or per transform
+ *          - Results are published as amplitude in dB per bin together
+ *            with the sample rate estimated from the timestamps
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SPECTRUMANALYZER_H
+#define SPECTRUMANALYZER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RealFft.h"
+#include "SpscQueue.h"
+
+/**
+ * @class SpectrumAnalyzer
+ * @brief Short-time amplitude spectra of accelerometer and gyroscope axes
+ *
+ * @details push() is called from one producer thread; setSize(), the
+ *          accessors and spectrum() may be called from any thread. Axes
+ *          follow the ImuBank channel order (accel X/Y/Z, gyro X/Y/Z).
+ */
+class SpectrumAnalyzer
+{
+public:
+    static constexpr int kAxes = 6;                 ///< Channels per IMU
+    static constexpr int kMaxImus = 16;             ///< Slots (as in ImuBank)
+    static constexpr std::size_t kMinSize = 256;    ///< Smallest FFT size
+    static constexpr std::size_t kMaxSize = 8192;   ///< Largest FFT size
+
+    /**
+     * @brief Creates a stopped analyzer
+     * @param size FFT size, a power of two in [kMinSize, kMaxSize]
+     */
+    explicit SpectrumAnalyzer(std::size_t size = 1024);
+
+    /**
+     * @brief Stops the worker thread
+     */
+    ~SpectrumAnalyzer();
+
+    SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+    SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+    /**
+     * @brief Starts the worker thread (no-op if running)
+     */
+    void start();
+
+    /**
+     * @brief Stops and joins the worker thread, queued samples are dropped
+     */
+    void stop();
+
+    /**
+     * @brief True between start() and stop()
+     */
+    bool running() const { return m_thread.joinable(); }
+
+    /**
+     * @brief Queues one sample of all axes (producer thread only)
+     * @param slot IMU slot, 0..kMaxImus-1
+     * @param values kAxes values in ImuBank channel order
+     * @param timestampNs Sample time (monotonicNowNs() clock)
+     * @return false if the queue was full and the sample was dropped
+     */
+    bool push(int slot, const float *values, int64_t timestampNs);
+
+    /**
+     * @brief Changes the FFT size; history and results start over
+     * @param size Power of two in [kMinSize, kMaxSize], otherwise ignored
+     */
+    void setSize(std::size_t size);
+
+    /**
+     * @brief Current FFT size
+     */
+    std::size_t size() const { return m_requestedSize.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Forgets the history and the results of every slot
+     */
+    void reset();
+
+    /**
+     * @brief Copies the newest spectrum of one axis
+     * @param slot IMU slot
+     * @param axis Channel, 0..kAxes-1
+     * @param out Receives size()/2 + 1 amplitudes in dB, DC to Nyquist
+     * @param frame Receives the number of spectra computed for the slot
+     *        (changes whenever a new spectrum is available); may be null
+     * @param rateHz Receives the estimated sample rate; may be null
+     * @return false if the slot has no spectrum yet (out is left untouched)
+     */
+    bool spectrum(int slot, int axis, std::vector<float> &out, uint64_t *frame = nullptr,
+                  float *rateHz = nullptr) const;
+
+    /**
+     * @brief Samples dropped because the worker fell behind
+     */
+    uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @struct Entry
+     * @brief Queued sample
+     */
+    struct Entry {
+        int32_t slot;                   ///< IMU slot
+        float values[kAxes];            ///< Axis values
+        int64_t timestampNs;            ///< Sample time
+    };
+
+    /**
+     * @struct Channel
+     * @brief Analysis state of one IMU (worker thread only)
+     */
+    struct Channel {
+        std::array<std::vector<float>, kAxes> history;  ///< Rings of the last N samples
+        uint64_t written = 0;           ///< Samples received since reset
+        int64_t hopStartNs = 0;         ///< Time of the first sample of the current hop
+        float rateHz = 0.0f;            ///< Smoothed sample rate
+    };
+
+    /**
+     * @struct Result
+     * @brief Published spectra of one IMU (guarded by m_resultMutex)
+     */
+    struct Result {
+        std::array<std::vector<float>, kAxes> decibels; ///< Amplitude per bin
+        uint64_t frame = 0;             ///< Spectra computed
+        float rateHz = 0.0f;            ///< Sample rate of the newest spectrum
+    };
+
+    /**
+     * @brief Worker thread body
+     */
+    void run();
+
+    /**
+     * @brief Reallocates tables and buffers for a new size (worker thread)
+     */
+    void configure(std::size_t size);
+
+    /**
+     * @brief Adds one sample and transforms after every hop (worker thread)
+     */
+    void process(const Entry &entry);
+
+    /**
+     * @brief Windows, transforms and publishes all axes of a slot
+     */
+    void analyze(int slot, Channel &channel);
+
+    SpscQueue<Entry> m_queue;                   ///< Producer -> worker
+    std::atomic<std::size_t> m_requestedSize;   ///< Size set by setSize()
+    std::atomic<bool> m_resetRequested{false};  ///< reset() called
+    std::atomic<uint64_t> m_dropped{0};         ///< Samples lost on a full queue
+
+    // Stan analizy - tylko watek roboczy
+    std::size_t m_size = 0;                     ///< Active FFT size
+    std::unique_ptr<RealFft> m_fft;             ///< Transform of the active size
+    std::vector<float> m_window;                ///< Hann coefficients
+    float m_decibelOffset = 0.0f;               ///< 20 log10(2 / sum(window)): bin power -> sine amplitude in dB
+    std::vector<float> m_frame;                 ///< Windowed input of one transform
+    std::array<std::vector<float>, kAxes> m_decibels;   ///< Spectra before publishing
+    std::array<Channel, kMaxImus> m_channels;   ///< Per-IMU history
+
+    mutable std::mutex m_resultMutex;           ///< Guards m_results
+    std::array<Result, kMaxImus> m_results;     ///< Published spectra
+
+    std::mutex m_wakeMutex;                     ///< Used with m_wake
+    std::condition_variable m_wake;             ///< Poll timer, interrupted by stop()
+    bool m_stopping = false;                    ///< Guarded by m_wakeMutex
+    std::thread m_thread;                       ///< Worker thread
+};
+
+#endif // SPECTRUMANALYZER_H
@@ -0,0 +1,200 @@
+#include "SpectrumPanel.h"
+#include <QHBoxLayout>
+#include <QVBoxLayout>
+
+#include <cmath>
+
+namespace {
+
+constexpr int kRefreshMs = 50;          // Okres odpytywania analizatora
+constexpr float kMinDb = -100.0f;       // Zakres osi amplitudy i skali wodospadu
+constexpr float kMaxDb = 20.0f;
+constexpr int kDefaultSizeIndex = 2;    // 1024 punkty
+
+} // namespace
+
+// Konstruktor panelu widma
+SpectrumPanel::SpectrumPanel(SpectrumAnalyzer &analyzer, const ImuBank &imus, QWidget *parent)
+    : QWidget(parent, Qt::Tool), m_analyzer(analyzer), m_imus(imus)
+{
+    m_imuLabel = new QLabel(this);
+    m_imuComboBox = new QComboBox(this);
+    m_sensorComboBox = new QComboBox(this);
+    m_sensorComboBox->addItem(QString(), ImuBank::AccelX);
+    m_sensorComboBox->addItem(QString(), ImuBank::GyroX);
+
+    m_sizeLabel = new QLabel(this);
+    m_sizeComboBox = new QComboBox(this);
+    for (int size : {256, 512, 1024, 2048, 4096})
+        m_sizeComboBox->addItem(QString::number(size), size);
+    m_sizeComboBox->setCurrentIndex(kDefaultSizeIndex);
+    m_analyzer.setSize(m_sizeComboBox->currentData().toInt());
+
+    m_waterfallCheckBox = new QCheckBox(this);
+    m_waterfallAxisComboBox = new QComboBox(this);
+    for (const char *axis : { "X", "Y", "Z" })
+        m_waterfallAxisComboBox->addItem(axis);
+    m_waterfallAxisComboBox->setEnabled(false);
+
+    m_infoLabel = new QLabel(this);
+
+    // === Wykres widma ===
+    m_chart = new QChart();
+    const char *axisNames[3] = { "X", "Y", "Z" };
+    for (int axis = 0; axis < 3; ++axis) {
+        m_series[axis] = new QLineSeries();
+        m_series[axis]->setName(axisNames[axis]);
+        m_chart->addSeries(m_series[axis]);
+    }
+    m_chart->createDefaultAxes();
+    m_chart->setMargins(QMargins(5, 5, 5, 5));
+
+    if (auto xAxis = qobject_cast<QValueAxis*>(m_chart->axisX())) {
+        m_axisX = xAxis;
+        m_axisX->setLabelFormat("%.0f");
+        m_axisX->setRange(0, 1);
+    }
+    if (auto yAxis = qobject_cast<QValueAxis*>(m_chart->axisY())) {
+        m_axisY = yAxis;
+        m_axisY->setLabelFormat("%.0f");
+        m_axisY->setTickCount(7);
+        m_axisY->setRange(kMinDb, kMaxDb);
+    }
+
+    m_chartView = new QChartView(m_chart, this);
+    m_chartView->setRenderHint(QPainter::Antialiasing);
+    m_chartView->setMinimumHeight(260);
+
+    // === Wodospad ===
+    m_waterfall = new WaterfallWidget(this);
+    m_waterfall->setRange(kMinDb, kMaxDb);
+    m_waterfall->setVisible(false);
+
+    QHBoxLayout *selectors = new QHBoxLayout();
+    selectors->addWidget(m_imuLabel);
+    selectors->addWidget(m_imuComboBox, 1);
+    selectors->addWidget(m_sensorComboBox, 1);
+    selectors->addSpacing(12);
+    selectors->addWidget(m_sizeLabel);
+    selectors->addWidget(m_sizeComboBox);
+    selectors->addSpacing(12);
+    selectors->addWidget(m_waterfallCheckBox);
+    selectors->addWidget(m_waterfallAxisComboBox);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(selectors);
+    layout->addWidget(m_chartView, 2);
+    layout->addWidget(m_waterfall, 1);
+    layout->addWidget(m_infoLabel);
+
+    connect(m_imuComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SpectrumPanel::restartView);
+    connect(m_sensorComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SpectrumPanel::restartView);
+    connect(m_waterfallAxisComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SpectrumPanel::restartView);
+    connect(m_sizeComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &SpectrumPanel::applySize);
+    connect(m_waterfallCheckBox, &QCheckBox::toggled, this, [this](bool checked) {
+        m_waterfallAxisComboBox->setEnabled(checked);
+        m_waterfall->clear();
+        m_waterfall->setVisible(checked);
+    });
+    connect(&m_timer, &QTimer::timeout, this, &SpectrumPanel::refresh);
+    m_timer.setInterval(kRefreshMs);
+
+    retranslateUi();
+    resize(760, 520);
+}
+
+// Analiza widma tylko przy widocznym panelu
+void SpectrumPanel::showEvent(QShowEvent *event)
+{
+    m_analyzer.start();
+    restartView();
+    m_timer.start();
+    QWidget::showEvent(event);
+}
+
+void SpectrumPanel::hideEvent(QHideEvent *event)
+{
+    m_timer.stop();
+    m_analyzer.stop();
+    QWidget::hideEvent(event);
+}
+
+// Dopisanie IMU, ktore pojawily sie od ostatniego odswiezenia
+void SpectrumPanel::updateSources()
+{
+    for (int slot = m_imuComboBox->count(); slot < m_imus.count(); ++slot)
+        m_imuComboBox->addItem(tr("IMU %1").arg(m_imus.id(slot)), slot);
+}
+
+// Nowy rozmiar FFT - analizator zaczyna od pustej historii
+void SpectrumPanel::applySize()
+{
+    m_analyzer.setSize(m_sizeComboBox->currentData().toInt());
+    restartView();
+}
+
+// Czyszczenie wykresow, nastepne widmo rysowane od razu
+void SpectrumPanel::restartView()
+{
+    m_lastFrame = 0;
+    for (QLineSeries *series : m_series)
+        series->clear();
+    m_waterfall->clear();
+}
+
+// Przepisanie nowego widma do wykresu i wodospadu
+void SpectrumPanel::refresh()
+{
+    updateSources();
+    if (m_imuComboBox->currentIndex() < 0) return;
+
+    const int slot = m_imuComboBox->currentData().toInt();
+    const int firstAxis = m_sensorComboBox->currentData().toInt();
+
+    uint64_t frame = 0;
+    float rateHz = 0.0f;
+    float binHz = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (!m_analyzer.spectrum(slot, firstAxis + axis, m_spectrum, &frame, &rateHz)) return;
+        if (frame == m_lastFrame || rateHz <= 0.0f) return;
+
+        // Rozdzielczosc z liczby pasm (po zmianie rozmiaru moze jeszcze przyjsc stare widmo)
+        binHz = rateHz / (2.0f * (m_spectrum.size() - 1));
+        m_points.resize(static_cast<int>(m_spectrum.size()));
+        for (int bin = 0; bin < m_points.size(); ++bin)
+            m_points[bin] = QPointF(bin * binHz, m_spectrum[bin]);
+        m_series[axis]->replace(m_points);
+
+        if (m_waterfall->isVisible() && axis == m_waterfallAxisComboBox->currentIndex())
+            m_waterfall->addRow(m_spectrum.data(), static_cast<int>(m_spectrum.size()));
+    }
+    m_lastFrame = frame;
+
+    // Zakres osi czestotliwosci zmieniany tylko przy wyraznej zmianie probkowania
+    const float nyquistHz = rateHz / 2.0f;
+    if (std::fabs(nyquistHz - m_axisMaxHz) > 0.01f * nyquistHz) {
+        m_axisMaxHz = nyquistHz;
+        m_axisX->setRange(0, nyquistHz);
+    }
+
+    m_infoLabel->setText(tr("Sample rate: %1 Hz, resolution: %2 Hz, dropped samples: %3")
+                             .arg(rateHz, 0, 'f', 0)
+                             .arg(binHz, 0, 'f', 2)
+                             .arg(m_analyzer.dropped()));
+}
+
+void SpectrumPanel::retranslateUi()
+{
+    setWindowTitle(tr("Vibration spectrum"));
+    m_imuLabel->setText(tr("Source:"));
+    for (int item = 0; item < m_imuComboBox->count(); ++item)
+        m_imuComboBox->setItemText(item, tr("IMU %1").arg(m_imus.id(item)));
+    m_sensorComboBox->setItemText(0, tr("Accelerometer"));
+    m_sensorComboBox->setItemText(1, tr("Gyroscope"));
+    m_sizeLabel->setText(tr("FFT size:"));
+    m_waterfallCheckBox->setText(tr("Waterfall"));
+
+    m_chart->setTitle(tr("Amplitude spectrum (Hann window, 50% overlap)"));
+    m_axisX->setTitleText(tr("Frequency [Hz]"));
+    m_axisY->setTitleText(tr("Amplitude [dB]"));
+}
@@ -0,0 +1,118 @@
+/**
+ * @file    SpectrumPanel.h
+ * @brief   Diagnostics window with the live vibration spectrum
+ *
+ * @details Shows the SpectrumAnalyzer output of one IMU sensor: the X/Y/Z
+ *          amplitude spectra as a chart and, optionally, a waterfall of one
+ *          axis. The analyzer runs only while the window is visible; the
+ *          chart is polled 20 times per second and redrawn when a new
+ *          spectrum is available.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SPECTRUMPANEL_H
+#define SPECTRUMPANEL_H
+
+#include <QWidget>
+#include <QCheckBox>
+#include <QComboBox>
+#include <QLabel>
+#include <QTimer>
+#include <QVector>
+#include <QtCharts/QChartView>
+#include <QtCharts/QLineSeries>
+#include <QtCharts/QChart>
+#include <QtCharts/QValueAxis>
+
+#include <vector>
+
+#include "ImuBank.h"
+#include "SpectrumAnalyzer.h"
+#include "WaterfallWidget.h"
+
+/**
+ * @class SpectrumPanel
+ * @brief Tool window displaying accelerometer or gyroscope spectra per IMU
+ */
+class SpectrumPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the panel
+     * @param analyzer Spectrum source, started and stopped by the panel
+     *        (must outlive the panel)
+     * @param imus IMUs offered for selection (must outlive the panel)
+     * @param parent Parent widget (default: nullptr)
+     */
+    SpectrumPanel(SpectrumAnalyzer &analyzer, const ImuBank &imus, QWidget *parent = nullptr);
+
+    /**
+     * @brief Updates all user-visible strings in the UI to reflect the current language.
+     */
+    void retranslateUi();
+
+protected:
+    /**
+     * @brief Starts the analyzer and the refresh timer
+     */
+    void showEvent(QShowEvent *event) override;
+
+    /**
+     * @brief Stops the analyzer and the refresh timer
+     */
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    /**
+     * @brief Redraws the chart and the waterfall if a new spectrum exists
+     */
+    void refresh();
+
+    /**
+     * @brief Applies the selected FFT size
+     */
+    void applySize();
+
+    /**
+     * @brief Clears the plots after a change of IMU, sensor or axis
+     */
+    void restartView();
+
+private:
+    /**
+     * @brief Adds IMUs registered since the last call
+     */
+    void updateSources();
+
+    SpectrumAnalyzer &m_analyzer;       ///< Spectrum source
+    const ImuBank &m_imus;              ///< IMU slots and IDs
+
+    QLabel *m_imuLabel;                 ///< Caption of the IMU selector
+    QComboBox *m_imuComboBox;           ///< IMU slot
+    QComboBox *m_sensorComboBox;        ///< First axis of the sensor (accel 0, gyro 3)
+    QLabel *m_sizeLabel;                ///< Caption of the size selector
+    QComboBox *m_sizeComboBox;          ///< FFT size
+    QCheckBox *m_waterfallCheckBox;     ///< Shows the waterfall
+    QComboBox *m_waterfallAxisComboBox; ///< Axis of the waterfall (0..2)
+    QLabel *m_infoLabel;                ///< Sample rate, resolution, drops
+
+    QChart *m_chart;                    ///< Spectrum plot
+    QChartView *m_chartView;            ///< Container for the chart
+    QLineSeries *m_series[3];           ///< X, Y, Z amplitude
+    QValueAxis *m_axisX;                ///< Frequency axis [Hz]
+    QValueAxis *m_axisY;                ///< Amplitude axis [dB]
+    WaterfallWidget *m_waterfall;       ///< Spectrogram of one axis
+
+    QTimer m_timer;                     ///< Poll clock
+    std::vector<float> m_spectrum;      ///< Reused copy of one axis
+    QVector<QPointF> m_points;          ///< Reused buffer for replace()
+    uint64_t m_lastFrame = 0;           ///< Spectrum already drawn
+    float m_axisMaxHz = 0.0f;           ///< Current frequency range
+};
+
+#endif // SPECTRUMPANEL_H
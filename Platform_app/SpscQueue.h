@@ -0,0 +1,135 @@
+/**
+ * @file    SpscQueue.h
+ * @brief   Bounded lock-free single-producer/single-consumer queue
+ *
+ * @details Fixed-capacity ring buffer used to hand decoded samples from the
+ *          serial ingestion thread to the GUI thread:
+ *          - Storage is allocated once at construction
+ *          - Push and pop never block and never allocate
+ *          - Exactly one producer thread and one consumer thread
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class SpscQueue
+ * @brief Wait-free bounded FIFO for one producer and one consumer
+ * @tparam T Trivially copyable element type
+ *
+ * @details The capacity is rounded up to a power of two so that indices can
+ *          be wrapped with a mask. Head and tail counters live on separate
+ *          cache lines to avoid false sharing between the two threads.
+ */
+template <typename T>
+class SpscQueue
+{
+public:
+    /**
+     * @brief Creates a queue able to hold at least @p capacity elements
+     * @param capacity Requested capacity (rounded up to a power of two)
+     */
+    explicit SpscQueue(std::size_t capacity)
+    {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        m_buffer.resize(size);
+        m_mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Appends an element (producer thread only)
+     * @param value Element to copy into the queue
+     * @return false if the queue is full and the element was dropped
+     */
+    bool tryPush(const T& value)
+    {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_headCache > m_mask) {
+            m_headCache = m_head.load(std::memory_order_acquire);
+            if (tail - m_headCache > m_mask)
+                return false;
+        }
+        m_buffer[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest element (consumer thread only)
+     * @param out Receives the element
+     * @return false if the queue is empty
+     */
+    bool tryPop(T& out)
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tailCache) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tailCache)
+                return false;
+        }
+        out = m_buffer[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Returns the oldest element without removing it (consumer thread only)
+     * @return Pointer to the element or nullptr if the queue is empty
+     */
+    const T* front()
+    {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tailCache) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if (head == m_tailCache)
+                return nullptr;
+        }
+        return &m_buffer[head & m_mask];
+    }
+
+    /**
+     * @brief Drops the element returned by front() (consumer thread only)
+     */
+    void pop()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Approximate number of queued elements (any thread)
+     */
+    std::size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Usable capacity of the queue
+     */
+    std::size_t capacity() const { return m_mask + 1; }
+
+private:
+    std::vector<T> m_buffer;                    ///< Element storage (power-of-two size)
+    std::size_t m_mask = 0;                     ///< Index wrap mask (capacity - 1)
+
+    alignas(64) std::atomic<std::size_t> m_head{0}; ///< Next element to pop (written by consumer)
+    std::size_t m_tailCache = 0;                ///< Consumer's cached copy of m_tail
+
+    alignas(64) std::atomic<std::size_t> m_tail{0}; ///< Next free slot (written by producer)
+    std::size_t m_headCache = 0;                ///< Producer's cached copy of m_head
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,131 @@
+#include "StatisticsPanel.h"
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QVBoxLayout>
+
+namespace {
+
+constexpr int kRefreshMs = 500;     // Okres odswiezania tabeli
+constexpr int kColumns = 6;         // Srednia, RMS, odchylenie, min, max, liczba probek
+constexpr int kDifferenceSource = -1;   // Pozycja listy dla roznicy IMU
+
+} // namespace
+
+// Konstruktor panelu statystyk
+StatisticsPanel::StatisticsPanel(const ImuStatistics &statistics, QWidget *parent)
+    : QWidget(parent, Qt::Tool), m_statistics(statistics)
+{
+    m_sourceLabel = new QLabel(this);
+    m_sourceComboBox = new QComboBox(this);
+    m_sourceComboBox->addItem(QString(), kDifferenceSource);
+
+    m_windowLabel = new QLabel(this);
+    m_windowComboBox = new QComboBox(this);
+    for (int window = 0; window < ImuStatistics::WindowCount; ++window)
+        m_windowComboBox->addItem(QString(), window);
+
+    m_table = new QTableWidget(ImuStatistics::kChannels, kColumns, this);
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionMode(QAbstractItemView::NoSelection);
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+
+    // Komorki tworzone raz, odswiezany jest tylko tekst
+    for (int row = 0; row < ImuStatistics::kChannels; ++row) {
+        for (int column = 0; column < kColumns; ++column) {
+            QTableWidgetItem *item = new QTableWidgetItem();
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            m_table->setItem(row, column, item);
+        }
+    }
+
+    m_resetButton = new QPushButton(this);
+    connect(m_resetButton, &QPushButton::clicked, this, [this]() {
+        emit resetRequested();
+        refresh();
+    });
+
+    QHBoxLayout *selectors = new QHBoxLayout();
+    selectors->addWidget(m_sourceLabel);
+    selectors->addWidget(m_sourceComboBox, 1);
+    selectors->addSpacing(12);
+    selectors->addWidget(m_windowLabel);
+    selectors->addWidget(m_windowComboBox, 1);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(selectors);
+    layout->addWidget(m_table);
+    layout->addWidget(m_resetButton, 0, Qt::AlignRight);
+
+    connect(m_sourceComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &StatisticsPanel::refresh);
+    connect(m_windowComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &StatisticsPanel::refresh);
+    connect(&m_timer, &QTimer::timeout, this, &StatisticsPanel::refresh);
+    m_timer.setInterval(kRefreshMs);
+
+    retranslateUi();
+    resize(620, 300);
+}
+
+// Odswiezanie tylko przy widocznym panelu
+void StatisticsPanel::showEvent(QShowEvent *event)
+{
+    refresh();
+    m_timer.start();
+    QWidget::showEvent(event);
+}
+
+void StatisticsPanel::hideEvent(QHideEvent *event)
+{
+    m_timer.stop();
+    QWidget::hideEvent(event);
+}
+
+// Dopisanie IMU, ktore pojawily sie od ostatniego odswiezenia
+void StatisticsPanel::updateSources()
+{
+    for (int source = m_sourceComboBox->count() - 1; source < m_statistics.imuCount(); ++source)
+        m_sourceComboBox->addItem(tr("IMU %1").arg(m_statistics.imuId(source)), source);
+}
+
+// Przepisanie statystyk wybranego zrodla do tabeli
+void StatisticsPanel::refresh()
+{
+    updateSources();
+
+    const int source = m_sourceComboBox->currentData().toInt();
+    const auto window = static_cast<ImuStatistics::Window>(m_windowComboBox->currentData().toInt());
+
+    for (int row = 0; row < ImuStatistics::kChannels; ++row) {
+        const RunningStats stats = (source == kDifferenceSource) ? m_statistics.difference(row, window)
+                                                                 : m_statistics.imu(source, row, window);
+        const bool empty = stats.count() == 0;
+
+        m_table->item(row, 0)->setText(empty ? QString("-") : QString::number(stats.mean(), 'f', 4));
+        m_table->item(row, 1)->setText(empty ? QString("-") : QString::number(stats.rms(), 'f', 4));
+        m_table->item(row, 2)->setText(empty ? QString("-") : QString::number(stats.stddev(), 'f', 4));
+        m_table->item(row, 3)->setText(empty ? QString("-") : QString::number(stats.min(), 'f', 4));
+        m_table->item(row, 4)->setText(empty ? QString("-") : QString::number(stats.max(), 'f', 4));
+        m_table->item(row, 5)->setText(QString::number(stats.count()));
+    }
+}
+
+void StatisticsPanel::retranslateUi()
+{
+    setWindowTitle(tr("IMU statistics"));
+    m_sourceLabel->setText(tr("Source:"));
+    m_windowLabel->setText(tr("Window:"));
+
+    m_sourceComboBox->setItemText(0, tr("Difference (error plot)"));
+    for (int item = 1; item < m_sourceComboBox->count(); ++item)
+        m_sourceComboBox->setItemText(item, tr("IMU %1").arg(m_statistics.imuId(item - 1)));
+
+    m_windowComboBox->setItemText(ImuStatistics::Second, tr("1 s"));
+    m_windowComboBox->setItemText(ImuStatistics::TenSeconds, tr("10 s"));
+    m_windowComboBox->setItemText(ImuStatistics::Minute, tr("60 s"));
+    m_windowComboBox->setItemText(ImuStatistics::Session, tr("Session"));
+
+    m_table->setHorizontalHeaderLabels({ tr("Mean"), tr("RMS"), tr("Std dev"), tr("Min"), tr("Max"), tr("Count") });
+    m_table->setVerticalHeaderLabels({ tr("Accel X [m/s²]"), tr("Accel Y [m/s²]"), tr("Accel Z [m/s²]"),
+                                       tr("Gyro X [rad/s]"), tr("Gyro Y [rad/s]"), tr("Gyro Z [rad/s]") });
+
+    m_resetButton->setText(tr("Reset"));
+}
@@ -0,0 +1,87 @@
+/**
+ * @file    StatisticsPanel.h
+ * @brief   Diagnostics window with live IMU statistics
+ *
+ * @details Shows ImuStatistics as a table with one row per axis (mean,
+ *          RMS, standard deviation, min, max, count) for a selected source
+ *          (one IMU or the IMU difference) and time window. The table is
+ *          refreshed twice per second while the window is visible.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef STATISTICSPANEL_H
+#define STATISTICSPANEL_H
+
+#include <QWidget>
+#include <QComboBox>
+#include <QLabel>
+#include <QTableWidget>
+#include <QPushButton>
+#include <QTimer>
+
+#include "ImuStatistics.h"
+
+/**
+ * @class StatisticsPanel
+ * @brief Tool window displaying mean, RMS, spread and peaks per IMU axis
+ */
+class StatisticsPanel : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs the panel
+     * @param statistics Statistics to display (must outlive the panel)
+     * @param parent Parent widget (default: nullptr)
+     */
+    explicit StatisticsPanel(const ImuStatistics &statistics, QWidget *parent = nullptr);
+
+    /**
+     * @brief Updates all user-visible strings in the UI to reflect the current language.
+     */
+    void retranslateUi();
+
+signals:
+    /**
+     * @brief The user asked to clear the statistics
+     */
+    void resetRequested();
+
+protected:
+    /**
+     * @brief Starts periodic refresh when shown
+     */
+    void showEvent(QShowEvent *event) override;
+
+    /**
+     * @brief Stops periodic refresh when hidden
+     */
+    void hideEvent(QHideEvent *event) override;
+
+private slots:
+    /**
+     * @brief Copies the selected summaries into the table
+     */
+    void refresh();
+
+private:
+    /**
+     * @brief Adds sources for IMUs registered since the last call
+     */
+    void updateSources();
+
+    const ImuStatistics &m_statistics;  ///< Displayed statistics
+    QLabel *m_sourceLabel;              ///< Caption of the source selector
+    QComboBox *m_sourceComboBox;        ///< IMU slot, or -1 for the difference
+    QLabel *m_windowLabel;              ///< Caption of the window selector
+    QComboBox *m_windowComboBox;        ///< ImuStatistics::Window
+    QTableWidget *m_table;              ///< One row per axis
+    QPushButton *m_resetButton;         ///< Clears the statistics
+    QTimer m_timer;                     ///< Refresh clock
+};
+
+#endif // STATISTICSPANEL_H
@@ -0,0 +1,219 @@
+#include "StewartKinematics.h"
+
+#include <cmath>
+
+namespace {
+
+const double kPi = 3.14159265358979323846;
+
+// Macierz obrotu R = Rz(yaw) * Ry(pitch) * Rx(roll)
+void rotationMatrix(double roll, double pitch, double yaw, double m[3][3])
+{
+    const double cr = std::cos(roll), sr = std::sin(roll);
+    const double cp = std::cos(pitch), sp = std::sin(pitch);
+    const double cy = std::cos(yaw), sy = std::sin(yaw);
+
+    m[0][0] = cy * cp;
+    m[0][1] = cy * sp * sr - sy * cr;
+    m[0][2] = cy * sp * cr + sy * sr;
+    m[1][0] = sy * cp;
+    m[1][1] = sy * sp * sr + cy * cr;
+    m[1][2] = sy * sp * cr - cy * sr;
+    m[2][0] = -sp;
+    m[2][1] = cp * sr;
+    m[2][2] = cp * cr;
+}
+
+// Rozwiazanie ukladu 6x6 (eliminacja Gaussa z wyborem elementu glownego)
+bool solve6(double a[6][6], double b[6])
+{
+    for (int col = 0; col < 6; ++col) {
+        int pivot = col;
+        for (int row = col + 1; row < 6; ++row) {
+            if (std::fabs(a[row][col]) > std::fabs(a[pivot][col])) pivot = row;
+        }
+        if (std::fabs(a[pivot][col]) < 1e-15) return false;
+
+        if (pivot != col) {
+            for (int k = 0; k < 6; ++k) {
+                const double t = a[col][k];
+                a[col][k] = a[pivot][k];
+                a[pivot][k] = t;
+            }
+            const double t = b[col];
+            b[col] = b[pivot];
+            b[pivot] = t;
+        }
+
+        for (int row = col + 1; row < 6; ++row) {
+            const double f = a[row][col] / a[col][col];
+            for (int k = col; k < 6; ++k)
+                a[row][k] -= f * a[col][k];
+            b[row] -= f * b[col];
+        }
+    }
+
+    for (int row = 5; row >= 0; --row) {
+        double sum = b[row];
+        for (int k = row + 1; k < 6; ++k)
+            sum -= a[row][k] * b[k];
+        b[row] = sum / a[row][row];
+    }
+    return true;
+}
+
+} // namespace
+
+// Kwaternion obrotu pozy (w, x, y, z)
+void stewartPoseQuaternion(const StewartPose &pose, double q[4])
+{
+    const double cr = std::cos(pose.roll * 0.5), sr = std::sin(pose.roll * 0.5);
+    const double cp = std::cos(pose.pitch * 0.5), sp = std::sin(pose.pitch * 0.5);
+    const double cy = std::cos(pose.yaw * 0.5), sy = std::sin(pose.yaw * 0.5);
+
+    q[0] = cy * cp * cr + sy * sp * sr;
+    q[1] = cy * cp * sr - sy * sp * cr;
+    q[2] = cy * sp * cr + sy * cp * sr;
+    q[3] = sy * cp * cr - cy * sp * sr;
+}
+
+// Konstruktor - polozenia przegubow i wysokosc bazowa
+StewartKinematics::StewartKinematics(const StewartGeometry &geometry)
+    : m_geometry(geometry)
+{
+    for (int i = 0; i < 6; ++i) {
+        // Para k wokol kierunku 90° + 120° * k
+        const double centre = kPi / 2.0 + (i / 2) * 2.0 * kPi / 3.0;
+        const double side = (i % 2) ? 1.0 : -1.0;
+
+        const double baseAngle = centre + side * geometry.baseHalfAngle;
+        m_base[i][0] = geometry.baseRadius * std::cos(baseAngle);
+        m_base[i][1] = geometry.baseRadius * std::sin(baseAngle);
+        m_base[i][2] = 0.0;
+
+        // Gorne przeguby przesuniete o 60° (nogi sie krzyzuja)
+        const double topAngle = centre + side * (kPi / 3.0 - geometry.platformHalfAngle);
+        m_top[i][0] = geometry.platformRadius * std::cos(topAngle);
+        m_top[i][1] = geometry.platformRadius * std::sin(topAngle);
+        m_top[i][2] = 0.0;
+
+        // Orczyk stycznie do okregu, w strone gornego przegubu
+        m_hornDir[i][0] = std::cos(baseAngle + side * kPi / 2.0);
+        m_hornDir[i][1] = std::sin(baseAngle + side * kPi / 2.0);
+    }
+
+    // Wysokosc, przy ktorej wszystkie katy sa zerowe (uklad symetryczny)
+    const double dx = m_top[0][0] - (m_base[0][0] + geometry.hornLength * m_hornDir[0][0]);
+    const double dy = m_top[0][1] - (m_base[0][1] + geometry.hornLength * m_hornDir[0][1]);
+    const double h2 = geometry.rodLength * geometry.rodLength - dx * dx - dy * dy;
+    m_homeHeight = h2 > 0.0 ? std::sqrt(h2) : 0.0;
+}
+
+// Kinematyka odwrotna - kat orczyka w postaci zamknietej
+bool StewartKinematics::inverse(const StewartPose &pose, double anglesDeg[6]) const
+{
+    double r[3][3];
+    rotationMatrix(pose.roll, pose.pitch, pose.yaw, r);
+
+    const double a = m_geometry.hornLength;
+    const double rod = m_geometry.rodLength;
+
+    for (int i = 0; i < 6; ++i) {
+        // Wektor od walu serwa do gornego przegubu
+        const double *p = m_top[i];
+        const double lx = pose.x + r[0][0] * p[0] + r[0][1] * p[1] + r[0][2] * p[2] - m_base[i][0];
+        const double ly = pose.y + r[1][0] * p[0] + r[1][1] * p[1] + r[1][2] * p[2] - m_base[i][1];
+        const double lz = m_homeHeight + pose.z + r[2][0] * p[0] + r[2][1] * p[1] + r[2][2] * p[2];
+
+        // |l - h(alpha)|² = rod²  =>  e*sin(alpha) + f*cos(alpha) = g
+        const double e = 2.0 * a * lz;
+        const double f = 2.0 * a * (m_hornDir[i][0] * lx + m_hornDir[i][1] * ly);
+        const double g = lx * lx + ly * ly + lz * lz + a * a - rod * rod;
+        const double norm = std::sqrt(e * e + f * f);
+        if (norm <= 0.0 || std::fabs(g) > norm) return false;
+
+        const double alpha = std::asin(g / norm) - std::atan2(f, e);
+        anglesDeg[i] = m_geometry.servoSign[i] * alpha * 180.0 / kPi;
+    }
+    return true;
+}
+
+// Reszty wiezow dlugosci pretow dla pozy p = (x, y, z, roll, pitch, yaw)
+void StewartKinematics::residuals(const double p[6], const double horns[6][3], double out[6]) const
+{
+    double r[3][3];
+    rotationMatrix(p[3], p[4], p[5], r);
+
+    const double rod2 = m_geometry.rodLength * m_geometry.rodLength;
+    for (int i = 0; i < 6; ++i) {
+        const double *t = m_top[i];
+        const double dx = p[0] + r[0][0] * t[0] + r[0][1] * t[1] + r[0][2] * t[2] - horns[i][0];
+        const double dy = p[1] + r[1][0] * t[0] + r[1][1] * t[1] + r[1][2] * t[2] - horns[i][1];
+        const double dz = m_homeHeight + p[2] + r[2][0] * t[0] + r[2][1] * t[1] + r[2][2] * t[2] - horns[i][2];
+        out[i] = dx * dx + dy * dy + dz * dz - rod2;
+    }
+}
+
+// Kinematyka prosta - Newton od poprzedniego rozwiazania
+bool StewartKinematics::forward(const double anglesDeg[6], StewartPose &pose)
+{
+    // Konce orczykow dla zadanych katow
+    double horns[6][3];
+    for (int i = 0; i < 6; ++i) {
+        const double alpha = m_geometry.servoSign[i] * anglesDeg[i] * kPi / 180.0;
+        const double reach = m_geometry.hornLength * std::cos(alpha);
+        horns[i][0] = m_base[i][0] + reach * m_hornDir[i][0];
+        horns[i][1] = m_base[i][1] + reach * m_hornDir[i][1];
+        horns[i][2] = m_geometry.hornLength * std::sin(alpha);
+    }
+
+    double p[6] = { m_pose.x, m_pose.y, m_pose.z, m_pose.roll, m_pose.pitch, m_pose.yaw };
+    double r[6];
+    residuals(p, horns, r);
+
+    for (m_iterations = 1; m_iterations <= kMaxIterations; ++m_iterations) {
+        // Jakobian roznicami skonczonymi
+        const double h = 1e-7;
+        double jacobian[6][6];
+        for (int k = 0; k < 6; ++k) {
+            double shifted[6] = { p[0], p[1], p[2], p[3], p[4], p[5] };
+            shifted[k] += h;
+            double rk[6];
+            residuals(shifted, horns, rk);
+            for (int i = 0; i < 6; ++i)
+                jacobian[i][k] = (rk[i] - r[i]) / h;
+        }
+
+        double step[6] = { -r[0], -r[1], -r[2], -r[3], -r[4], -r[5] };
+        if (!solve6(jacobian, step)) break;
+
+        double largest = 0.0;
+        for (int k = 0; k < 6; ++k) {
+            p[k] += step[k];
+            largest = std::fmax(largest, std::fabs(step[k]));
+        }
+        residuals(p, horns, r);
+
+        if (largest < kTolerance) {
+            m_pose.x = p[0];
+            m_pose.y = p[1];
+            m_pose.z = p[2];
+            m_pose.roll = p[3];
+            m_pose.pitch = p[4];
+            m_pose.yaw = p[5];
+            pose = m_pose;
+            return true;
+        }
+    }
+
+    // Brak zbieznosci - kolejne wywolanie startuje od pozycji bazowej
+    pose = m_pose;
+    reset();
+    return false;
+}
+
+// Powrot do pozycji bazowej
+void StewartKinematics::reset()
+{
+    m_pose = StewartPose();
+}
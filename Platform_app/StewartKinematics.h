@@ -0,0 +1,143 @@
+/**
+ * @file    StewartKinematics.h
+ * @brief   Inverse and forward kinematics of the rotary-servo Stewart platform
+ *
+ * @details Relates the six servo angles of the S: frames to the pose of
+ *          the top plate:
+ *          - Inverse kinematics in closed form (pose to servo angles)
+ *          - Forward kinematics by Newton iteration on the six rod length
+ *            constraints, warm-started from the previous solution, which
+ *            normally converges in two or three iterations
+ *          - No allocation, fixed 6x6 linear algebra in double precision
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef STEWARTKINEMATICS_H
+#define STEWARTKINEMATICS_H
+
+/**
+ * @struct StewartGeometry
+ * @brief Dimensions of the platform (metres and radians)
+ *
+ * @details Joints come in three pairs 120° apart. Leg i is driven by
+ *          servo i; odd servos are mounted mirrored, so the same angle
+ *          moves their horn the other way (servoSign).
+ */
+struct StewartGeometry {
+    double baseRadius = 0.100;              ///< Servo shaft circle radius
+    double platformRadius = 0.075;          ///< Top joint circle radius
+    double baseHalfAngle = 0.2618;          ///< Half the angle between the servos of a pair (15°)
+    double platformHalfAngle = 0.2618;      ///< Half the angle between the top joints of a pair (15°)
+    double hornLength = 0.030;              ///< Servo horn length
+    double rodLength = 0.130;               ///< Rod length between horn and top joint
+    int servoSign[6] = { 1, -1, 1, -1, 1, -1 }; ///< +1 if a positive angle raises the horn
+};
+
+/**
+ * @struct StewartPose
+ * @brief Pose of the top plate relative to the home position
+ *
+ * @details Base frame: z up, x towards the gap between pairs 0 and 2.
+ *          Rotation is R = Rz(yaw) · Ry(pitch) · Rx(roll), applied about
+ *          the plate centre.
+ */
+struct StewartPose {
+    double x = 0.0;         ///< Surge (m)
+    double y = 0.0;         ///< Sway (m)
+    double z = 0.0;         ///< Heave above the home height (m)
+    double roll = 0.0;      ///< Rotation about x (rad)
+    double pitch = 0.0;     ///< Rotation about y (rad)
+    double yaw = 0.0;       ///< Rotation about z (rad)
+};
+
+/**
+ * @brief Rotation of a pose as a quaternion
+ * @param pose Pose to convert
+ * @param q Receives (w, x, y, z)
+ */
+void stewartPoseQuaternion(const StewartPose &pose, double q[4]);
+
+/**
+ * @class StewartKinematics
+ * @brief Pose solver for one platform
+ *
+ * @details forward() keeps its last solution as the starting point of the
+ *          next call; feed it consecutive frames of one stream.
+ */
+class StewartKinematics
+{
+public:
+    /**
+     * @brief Creates a solver starting at the home pose
+     * @param geometry Platform dimensions
+     */
+    explicit StewartKinematics(const StewartGeometry &geometry = StewartGeometry());
+
+    /**
+     * @brief Platform dimensions
+     */
+    const StewartGeometry &geometry() const { return m_geometry; }
+
+    /**
+     * @brief Height of the top joints above the servo shafts with all angles at 0
+     */
+    double homeHeight() const { return m_homeHeight; }
+
+    /**
+     * @brief Servo angles that produce a pose
+     * @param pose Target pose
+     * @param anglesDeg Receives six servo angles in degrees
+     * @return false if a leg cannot reach the pose
+     */
+    bool inverse(const StewartPose &pose, double anglesDeg[6]) const;
+
+    /**
+     * @brief Pose produced by six servo angles
+     * @param anglesDeg Servo angles in degrees (S: frame order)
+     * @param pose Receives the solution
+     * @return false if Newton did not converge; the warm start is then
+     *         reset to the home pose and @p pose keeps the last solution
+     */
+    bool forward(const double anglesDeg[6], StewartPose &pose);
+
+    /**
+     * @brief Last converged solution
+     */
+    const StewartPose &pose() const { return m_pose; }
+
+    /**
+     * @brief Newton iterations used by the last forward() call
+     */
+    int iterations() const { return m_iterations; }
+
+    /**
+     * @brief Restarts forward() from the home pose
+     */
+    void reset();
+
+private:
+    static constexpr int kMaxIterations = 20;       ///< Newton iteration limit
+    static constexpr double kTolerance = 1e-10;     ///< Converged when every step is below (m, rad)
+
+    /**
+     * @brief Rod constraint residuals |rod|² - L² of a pose
+     * @param p Pose as (x, y, z, roll, pitch, yaw)
+     * @param horns Horn tips for the current angles
+     * @param r Receives six residuals
+     */
+    void residuals(const double p[6], const double horns[6][3], double r[6]) const;
+
+    StewartGeometry m_geometry;     ///< Platform dimensions
+    double m_base[6][3];            ///< Servo shaft positions
+    double m_top[6][3];             ///< Top joints in the plate frame
+    double m_hornDir[6][2];         ///< Horizontal direction of each horn at 0°
+    double m_homeHeight = 0.0;      ///< Plate height at all angles 0
+
+    StewartPose m_pose;             ///< Warm start and last solution
+    int m_iterations = 0;           ///< Iterations of the last solve
+};
+
+#endif // STEWARTKINEMATICS_H
@@ -0,0 +1,170 @@
+#include "StreamDecoder.h"
+#include "BinaryProtocol.h"
+#include "FrameDecoder.h"
+
+namespace {
+
+// Biale znaki obcinane z linii tekstowych (jak QByteArray::trimmed)
+inline bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+}
+
+inline std::string_view trimmed(std::string_view s)
+{
+    std::size_t begin = 0;
+    std::size_t end = s.size();
+    while (begin < end && isSpace(s[begin])) ++begin;
+    while (end > begin && isSpace(s[end - 1])) --end;
+    return s.substr(begin, end - begin);
+}
+
+// Mapowanie statusu dekodera tekstowego
+StreamDecoder::Status fromAscii(FrameDecoder::Status status)
+{
+    switch (status) {
+    case FrameDecoder::Status::Ok:            return StreamDecoder::Status::Ok;
+    case FrameDecoder::Status::Unrecognized:  return StreamDecoder::Status::Unrecognized;
+    case FrameDecoder::Status::BadCrcFormat:  return StreamDecoder::Status::BadCrcFormat;
+    case FrameDecoder::Status::BadFieldCount: return StreamDecoder::Status::BadFieldCount;
+    case FrameDecoder::Status::BadValue:      return StreamDecoder::Status::BadValue;
+    case FrameDecoder::Status::CrcMismatch:   return StreamDecoder::Status::CrcMismatch;
+    }
+    return StreamDecoder::Status::Unrecognized;
+}
+
+// Mapowanie statusu dekodera binarnego
+StreamDecoder::Status fromBinary(BinaryProtocol::Status status)
+{
+    switch (status) {
+    case BinaryProtocol::Status::Ok:          return StreamDecoder::Status::Ok;
+    case BinaryProtocol::Status::BadFraming:  return StreamDecoder::Status::BadFraming;
+    case BinaryProtocol::Status::BadType:     return StreamDecoder::Status::BadFraming;
+    case BinaryProtocol::Status::CrcMismatch: return StreamDecoder::Status::CrcMismatch;
+    }
+    return StreamDecoder::Status::BadFraming;
+}
+
+} // namespace
+
+// Konstruktor dekodera strumienia
+StreamDecoder::StreamDecoder(std::size_t bufferSize)
+    : m_framer(bufferSize)
+{
+}
+
+// Dekodowanie kolejnej ramki z bufora
+StreamDecoder::Result StreamDecoder::next(PlatformSample &sample)
+{
+    Result result;
+
+    while (true) {
+        std::string_view frame;
+        char delimiter = '\n';
+        bool complete;
+
+        switch (m_protocol) {
+        case Protocol::Ascii:
+            complete = m_framer.nextRecord(frame, '\n');
+            break;
+        case Protocol::Binary:
+            delimiter = '\0';
+            complete = m_framer.nextRecord(frame, '\0');
+            break;
+        default:
+            complete = m_framer.nextRecord(frame, '\n', '\0', delimiter);
+            break;
+        }
+
+        if (!complete) {
+            // Dlugi ciag bez separatora - prawdopodobnie zmiana protokolu
+            const std::size_t backlog = (m_protocol == Protocol::Binary)
+                                            ? 4 * BinaryProtocol::kMaxFrameSize : kMaxLineBacklog;
+            if (m_protocol != Protocol::Unknown && m_framer.pendingBytes() > backlog) {
+                m_protocol = Protocol::Unknown;
+                m_streak = 0;
+                continue;
+            }
+            result.status = Status::NeedMoreData;
+            return result;
+        }
+
+        // Czas wyodrebnienia ramki (pomiar opoznien)
+        if (m_timestamps) result.framedNs = monotonicNowNs();
+
+        if (delimiter == '\n') {
+            frame = trimmed(frame);
+            if (frame.empty()) continue;
+
+            const FrameDecoder::Result ascii = FrameDecoder::decode(frame, sample);
+            result.protocol = Protocol::Ascii;
+            result.status = fromAscii(ascii.status);
+            result.type = ascii.type;
+            result.receivedCrc = ascii.receivedCrc;
+            result.calculatedCrc = ascii.calculatedCrc;
+        } else {
+            if (frame.empty()) continue;  // Kolejne zera miedzy ramkami
+
+            const BinaryProtocol::Result binary = BinaryProtocol::decode(frame, sample);
+            result.protocol = Protocol::Binary;
+            result.status = fromBinary(binary.status);
+            result.type = binary.type;
+            result.receivedCrc = binary.receivedCrc;
+            result.calculatedCrc = binary.calculatedCrc;
+
+            // Wykrywanie zgubionych ramek po numerze sekwencyjnym
+            if (result.status == Status::Ok) {
+                if (m_haveSequence) {
+                    const uint16_t gap = static_cast<uint16_t>(binary.sequence - m_lastSequence - 1);
+                    if (gap != 0 && gap < 0x8000)
+                        m_counters.lostFrames += gap;
+                }
+                m_lastSequence = binary.sequence;
+                m_haveSequence = true;
+            }
+        }
+
+        result.frame = frame;
+        track(result);
+        return result;
+    }
+}
+
+// Aktualizacja wykrywania protokolu
+void StreamDecoder::track(const Result &result)
+{
+    if (result.status == Status::Ok) {
+        ++m_counters.frames;
+        m_errorStreak = 0;
+
+        if (result.protocol == m_candidate) {
+            ++m_streak;
+        } else {
+            m_candidate = result.protocol;
+            m_streak = 1;
+        }
+
+        if (m_protocol == Protocol::Unknown && m_streak >= kLockFrames)
+            m_protocol = m_candidate;
+        return;
+    }
+
+    ++m_counters.errors;
+    m_streak = 0;
+    if (m_protocol != Protocol::Unknown && ++m_errorStreak >= kUnlockErrors) {
+        m_protocol = Protocol::Unknown;
+        m_errorStreak = 0;
+    }
+}
+
+// Reset stanu (np. po ponownym polaczeniu)
+void StreamDecoder::reset()
+{
+    m_framer.reset();
+    m_protocol = Protocol::Unknown;
+    m_candidate = Protocol::Unknown;
+    m_streak = 0;
+    m_errorStreak = 0;
+    m_haveSequence = false;
+    m_counters = Counters();
+}
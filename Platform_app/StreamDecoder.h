@@ -0,0 +1,178 @@
+/**
+ * @file    StreamDecoder.h
+ * @brief   Protocol-detecting decoder for the platform byte stream
+ *
+ * @details Turns raw serial bytes into validated samples for both wire
+ *          formats:
+ *          - ASCII lines ("IMU:..."/"S:..." terminated by '\n')
+ *          - COBS framed binary records (terminated by 0x00)
+ *
+ *          The protocol is detected automatically on the same port, so the
+ *          rest of the application receives the same PlatformSample values
+ *          regardless of what is on the wire.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef STREAMDECODER_H
+#define STREAMDECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "LineFramer.h"
+#include "PlatformSample.h"
+
+/**
+ * @class StreamDecoder
+ * @brief Per-connection framing, protocol detection and validation
+ *
+ * @details Starts in Protocol::Unknown and frames on both delimiters. After
+ *          a few consecutive valid frames of one kind it locks onto that
+ *          protocol and only scans for its delimiter. A run of invalid
+ *          frames, or a backlog of bytes without a delimiter, drops it back
+ *          to detection (e.g. when the firmware is switched at runtime).
+ *
+ * Pull-style use:
+ * @code
+ * const LineFramer::WriteSpan span = decoder.writeSpan();
+ * decoder.commit(port->read(span.data, span.size));
+ * PlatformSample sample;
+ * for (auto r = decoder.next(sample); r.status != StreamDecoder::Status::NeedMoreData; r = decoder.next(sample)) {
+ *     if (r.status == StreamDecoder::Status::Ok) consume(sample);
+ * }
+ * @endcode
+ */
+class StreamDecoder
+{
+public:
+    /**
+     * @enum Protocol
+     * @brief Wire format of the stream
+     */
+    enum class Protocol {
+        Unknown,  ///< Still detecting
+        Ascii,    ///< Text lines with CRC-8
+        Binary    ///< COBS framed records with CRC-16
+    };
+
+    /**
+     * @enum Status
+     * @brief Outcome of one call to next()
+     */
+    enum class Status {
+        Ok,             ///< Valid sample decoded
+        NeedMoreData,   ///< No complete frame buffered
+        Unrecognized,   ///< ASCII line that is not a known frame
+        BadCrcFormat,   ///< ASCII checksum field malformed
+        BadFieldCount,  ///< ASCII frame with wrong number of fields
+        BadValue,       ///< ASCII field is not a valid integer
+        BadFraming,     ///< Binary record with invalid COBS encoding or length
+        CrcMismatch     ///< Checksum does not match the payload
+    };
+
+    /**
+     * @struct Result
+     * @brief Decoding outcome with details for diagnostics
+     */
+    struct Result {
+        Status status = Status::NeedMoreData;                  ///< Outcome
+        Protocol protocol = Protocol::Unknown;                 ///< Format of the frame
+        PlatformSample::Type type = PlatformSample::Type::Imu; ///< Frame type when known
+        uint32_t receivedCrc = 0;                              ///< Checksum sent in the frame
+        uint32_t calculatedCrc = 0;                            ///< Checksum computed locally
+        std::string_view frame;                                ///< Raw frame (valid until the next write)
+        int64_t framedNs = 0;                                  ///< Time the frame was delimited (see setTimestamps())
+    };
+
+    /**
+     * @struct Counters
+     * @brief Running statistics of the stream
+     */
+    struct Counters {
+        uint64_t frames = 0;      ///< Valid frames decoded
+        uint64_t errors = 0;      ///< Frames rejected by validation
+        uint64_t lostFrames = 0;  ///< Binary frames missing according to sequence numbers
+    };
+
+    /**
+     * @brief Constructs a decoder
+     * @param bufferSize Size of the framing buffer in bytes
+     */
+    explicit StreamDecoder(std::size_t bufferSize = 64 * 1024);
+
+    /**
+     * @brief Free space for incoming bytes (see LineFramer::writeSpan())
+     */
+    LineFramer::WriteSpan writeSpan() { return m_framer.writeSpan(); }
+
+    /**
+     * @brief Marks @p count bytes written into the last writeSpan() as received
+     */
+    void commit(std::size_t count) { m_framer.commit(count); }
+
+    /**
+     * @brief Copies received bytes into the decoder
+     */
+    void append(const char *data, std::size_t size) { m_framer.append(data, size); }
+
+    /**
+     * @brief Decodes the next buffered frame
+     * @param sample Receives the decoded sample when the status is Ok
+     * @return Decoding result; Status::NeedMoreData when nothing is left
+     *
+     * @note The sample timestamp is left untouched.
+     */
+    Result next(PlatformSample &sample);
+
+    /**
+     * @brief Clears buffered bytes, detection state and sequence tracking
+     */
+    void reset();
+
+    /**
+     * @brief Enables stamping Result::framedNs for latency measurements
+     * @param enabled true to read the clock once per frame
+     */
+    void setTimestamps(bool enabled) { m_timestamps = enabled; }
+
+    /**
+     * @brief Currently detected protocol
+     */
+    Protocol protocol() const { return m_protocol; }
+
+    /**
+     * @brief Running statistics
+     */
+    const Counters &counters() const { return m_counters; }
+
+    /**
+     * @brief Over-long frames discarded by the framer
+     */
+    uint64_t overflowCount() const { return m_framer.overflowCount(); }
+
+private:
+    /**
+     * @brief Updates protocol detection after a frame was processed
+     */
+    void track(const Result &result);
+
+    static constexpr int kLockFrames = 3;           ///< Consecutive valid frames needed to lock
+    static constexpr int kUnlockErrors = 8;         ///< Consecutive bad frames that restart detection
+    static constexpr std::size_t kMaxLineBacklog = 256; ///< ASCII bytes without '\n' that restart detection
+
+    LineFramer m_framer;                        ///< Buffer and delimiter search
+    Protocol m_protocol = Protocol::Unknown;    ///< Locked protocol
+    Protocol m_candidate = Protocol::Unknown;   ///< Protocol of the current valid streak
+    int m_streak = 0;                           ///< Consecutive valid frames of m_candidate
+    int m_errorStreak = 0;                      ///< Consecutive invalid frames
+    bool m_haveSequence = false;                ///< m_lastSequence is valid
+    uint16_t m_lastSequence = 0;                ///< Last binary sequence number
+    Counters m_counters;                        ///< Running statistics
+    bool m_timestamps = false;                  ///< Fill Result::framedNs
+};
+
+#endif // STREAMDECODER_H
@@ -0,0 +1,230 @@
+/**
+ * @file    StreamingStats.h
+ * @brief   Constant-time running and sliding-window statistics
+ *
+ * @details Building blocks for live signal statistics:
+ *          - RunningStats: Welford mean/variance with min, max and RMS,
+ *            mergeable (Chan et al.), numerically stable for large offsets
+ *          - WindowedStats: the same over a sliding time window, kept as
+ *            a ring of time buckets allocated once at construction; a
+ *            bucket only accumulates shifted sums (no division per sample)
+ *          Every update is O(1) and never allocates.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef STREAMINGSTATS_H
+#define STREAMINGSTATS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @class RunningStats
+ * @brief Summary of a sample stream
+ */
+class RunningStats
+{
+public:
+    /**
+     * @brief Adds one sample
+     */
+    void add(double x)
+    {
+        ++m_count;
+        const double delta = x - m_mean;
+        m_mean += delta / m_count;
+        m_m2 += delta * (x - m_mean);
+        m_min = std::min(m_min, x);
+        m_max = std::max(m_max, x);
+    }
+
+    /**
+     * @brief Adds all samples summarized by another instance
+     */
+    void merge(const RunningStats &other)
+    {
+        if (other.m_count == 0) return;
+        if (m_count == 0) {
+            *this = other;
+            return;
+        }
+
+        const uint64_t count = m_count + other.m_count;
+        const double delta = other.m_mean - m_mean;
+        m_mean += delta * other.m_count / count;
+        m_m2 += other.m_m2 + delta * delta * (static_cast<double>(m_count) * other.m_count / count);
+        m_count = count;
+        m_min = std::min(m_min, other.m_min);
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    /**
+     * @brief Forgets all samples
+     */
+    void reset() { *this = RunningStats(); }
+
+    /**
+     * @brief Builds a summary from precomputed moments
+     * @param count Number of samples
+     * @param mean Mean of the samples
+     * @param m2 Sum of squared deviations from the mean
+     * @param min Smallest sample
+     * @param max Largest sample
+     */
+    static RunningStats fromMoments(uint64_t count, double mean, double m2, double min, double max)
+    {
+        RunningStats stats;
+        if (count == 0) return stats;
+        stats.m_count = count;
+        stats.m_mean = mean;
+        stats.m_m2 = std::max(0.0, m2);
+        stats.m_min = min;
+        stats.m_max = max;
+        return stats;
+    }
+
+    uint64_t count() const { return m_count; }             ///< Number of samples
+    double mean() const { return m_mean; }                  ///< Arithmetic mean, 0 if empty
+    double variance() const { return m_count ? m_m2 / m_count : 0.0; }  ///< Population variance
+    double stddev() const { return std::sqrt(variance()); }            ///< Population standard deviation
+    double rms() const { return std::sqrt(m_mean * m_mean + variance()); }  ///< Root mean square
+    double min() const { return m_count ? m_min : 0.0; }    ///< Smallest sample, 0 if empty
+    double max() const { return m_count ? m_max : 0.0; }    ///< Largest sample, 0 if empty
+
+private:
+    uint64_t m_count = 0;                                       ///< Samples
+    double m_mean = 0.0;                                        ///< Running mean
+    double m_m2 = 0.0;                                          ///< Sum of squared deviations
+    double m_min = std::numeric_limits<double>::infinity();     ///< Smallest sample
+    double m_max = -std::numeric_limits<double>::infinity();    ///< Largest sample
+};
+
+/**
+ * @class WindowedStats
+ * @brief RunningStats over the most recent part of a timestamped stream
+ *
+ * @details The window is split into equal buckets; a sample goes into
+ *          the bucket of its timestamp and whole buckets expire. The
+ *          covered span is therefore between window - bucket and window.
+ *          Timestamps are expected to be non-decreasing.
+ */
+class WindowedStats
+{
+public:
+    /**
+     * @brief Creates an empty window
+     * @param windowNs Window length in nanoseconds
+     * @param buckets Number of buckets (time resolution = windowNs / buckets)
+     */
+    WindowedStats(int64_t windowNs, int buckets)
+        : m_bucketNs(std::max<int64_t>(1, windowNs / std::max(1, buckets))),
+          m_buckets(std::max(1, buckets)),
+          m_index(m_buckets.size(), kNoBucket)
+    {
+    }
+
+    /**
+     * @brief Adds one sample
+     * @param x Value
+     * @param timestampNs Time of the sample
+     */
+    void add(double x, int64_t timestampNs)
+    {
+        timestampNs = std::max(timestampNs, m_lastNs);
+
+        // Division only when the sample leaves the current bucket
+        if (timestampNs >= m_currentEndNs) {
+            const int64_t index = bucketIndex(timestampNs);
+            m_current = static_cast<std::size_t>(index % static_cast<int64_t>(m_buckets.size()));
+            m_currentEndNs = (index + 1) * m_bucketNs;
+
+            // Bucket from the previous lap of the ring starts over
+            if (m_index[m_current] != index) {
+                m_buckets[m_current] = Bucket();
+                m_buckets[m_current].shift = x;
+                m_index[m_current] = index;
+            }
+        }
+        Bucket &bucket = m_buckets[m_current];
+
+        // Sums relative to the first value keep the variance accurate for large offsets
+        const double d = x - bucket.shift;
+        ++bucket.count;
+        bucket.sum += d;
+        bucket.sumSq += d * d;
+        bucket.min = std::min(bucket.min, x);
+        bucket.max = std::max(bucket.max, x);
+        m_lastNs = timestampNs;
+    }
+
+    /**
+     * @brief Statistics of the window ending at the newest sample
+     *
+     * @details O(buckets); meant for displays, not for every sample.
+     */
+    RunningStats summary() const
+    {
+        RunningStats result;
+        const int64_t newest = bucketIndex(m_lastNs);
+        const int64_t oldest = newest - static_cast<int64_t>(m_buckets.size()) + 1;
+        for (std::size_t i = 0; i < m_buckets.size(); ++i) {
+            if (m_index[i] == kNoBucket || m_index[i] < oldest || m_index[i] > newest) continue;
+
+            const Bucket &bucket = m_buckets[i];
+            const double mean = bucket.sum / bucket.count;
+            result.merge(RunningStats::fromMoments(bucket.count, bucket.shift + mean,
+                                                   bucket.sumSq - bucket.sum * mean, bucket.min, bucket.max));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Forgets all samples
+     */
+    void reset()
+    {
+        std::fill(m_index.begin(), m_index.end(), kNoBucket);
+        m_lastNs = std::numeric_limits<int64_t>::min();
+        m_currentEndNs = std::numeric_limits<int64_t>::min();
+    }
+
+private:
+    static constexpr int64_t kNoBucket = std::numeric_limits<int64_t>::min();  ///< Unused bucket
+
+    /**
+     * @struct Bucket
+     * @brief Raw moments of the samples of one time slice
+     */
+    struct Bucket {
+        uint64_t count = 0;     ///< Samples
+        double shift = 0.0;     ///< First sample, subtracted from all others
+        double sum = 0.0;       ///< Sum of shifted samples
+        double sumSq = 0.0;     ///< Sum of squared shifted samples
+        double min = std::numeric_limits<double>::infinity();   ///< Smallest sample
+        double max = -std::numeric_limits<double>::infinity();  ///< Largest sample
+    };
+
+    /**
+     * @brief Absolute bucket number of a time (floor division)
+     */
+    int64_t bucketIndex(int64_t timestampNs) const
+    {
+        const int64_t q = timestampNs / m_bucketNs;
+        return (timestampNs % m_bucketNs < 0) ? q - 1 : q;
+    }
+
+    int64_t m_bucketNs;                         ///< Bucket length
+    std::vector<Bucket> m_buckets;              ///< Ring of buckets
+    std::vector<int64_t> m_index;               ///< Absolute bucket number per slot
+    int64_t m_lastNs = std::numeric_limits<int64_t>::min();   ///< Newest timestamp
+    int64_t m_currentEndNs = std::numeric_limits<int64_t>::min();   ///< End of the bucket being filled
+    std::size_t m_current = 0;                  ///< Slot of the bucket being filled
+};
+
+#endif // STREAMINGSTATS_H
@@ -0,0 +1,194 @@
+#include "ValueReadout.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QEvent>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+// to_chars dla float: libstdc++ 11+, libc++ na macOS dopiero od 13.3
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L && !defined(__APPLE__)
+#define VALUEREADOUT_FLOAT_TO_CHARS 1
+#else
+#define VALUEREADOUT_FLOAT_TO_CHARS 0
+#endif
+
+namespace {
+
+// Zapis wartosci z ustalona liczba miejsc po przecinku; zwraca dlugosc lub 0 przy braku miejsca
+int formatFixed(char *out, int capacity, float value, int decimals) {
+#if VALUEREADOUT_FLOAT_TO_CHARS
+    const std::to_chars_result result =
+        std::to_chars(out, out + capacity, value, std::chars_format::fixed, decimals);
+    return (result.ec == std::errc()) ? static_cast<int>(result.ptr - out) : 0;
+#else
+    // Liczba calkowita w jednostkach ostatniej cyfry i kropka wstawiona recznie
+    // (to_chars dla liczb calkowitych; snprintf zalezy od locale ustawionego przez Qt)
+    if (!std::isfinite(value) || std::fabs(value) > 1e12f) return 0;
+    long long scale = 1;
+    for (int i = 0; i < decimals; ++i) scale *= 10;
+    const long long scaled = std::llround(static_cast<double>(value) * scale);
+    const long long magnitude = scaled < 0 ? -scaled : scaled;
+
+    char digits[24];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), magnitude);
+    int count = static_cast<int>(result.ptr - digits);
+
+    // Zera wiodace, aby zawsze byla cyfra przed kropka
+    const int integerDigits = count > decimals ? count - decimals : 1;
+    const int length = (scaled < 0 ? 1 : 0) + integerDigits + (decimals > 0 ? 1 + decimals : 0);
+    if (length > capacity) return 0;
+
+    char *p = out + length;
+    for (int i = 0; i < decimals; ++i)
+        *--p = count > 0 ? digits[--count] : '0';
+    if (decimals > 0) *--p = '.';
+    if (count == 0) *--p = '0';
+    while (count > 0) *--p = digits[--count];
+    if (scaled < 0) *--p = '-';
+    return length;
+#endif
+}
+
+} // namespace
+
+// Konstruktor odczytu wartosci
+ValueReadout::ValueReadout(int rows, QWidget *parent)
+    : QWidget(parent), rows(qMax(0, rows)) {
+    for (Row &row : this->rows) {
+        std::memcpy(row.text, "0.00", 4);
+        row.length = 4;
+    }
+    recomputeLayout();
+}
+
+// Ustawienie nazwy i jednostki wiersza
+void ValueReadout::setRow(int row, const QString &name, const QString &unit) {
+    if (row < 0 || row >= rows.size()) return;
+    rows[row].name = name;
+    rows[row].unit = unit;
+    recomputeLayout();
+}
+
+// Linia oddzielajaca pod wierszem
+void ValueReadout::setSeparatorAfter(int row) {
+    if (row < 0 || row >= rows.size()) return;
+    rows[row].separator = true;
+    recomputeLayout();
+}
+
+// Ustawienie wartosci wiersza (przerysowanie tylko przy zmianie cyfr)
+void ValueReadout::setValue(int row, float value) {
+    if (row < 0 || row >= rows.size()) return;
+
+    char buffer[maxChars];
+    const int length = formatFixed(buffer, maxChars, value, decimals);
+
+    // "-0.00" wyswietlane jako "0.00"
+    const bool negativeZero = length == decimals + 3 && buffer[0] == '-'
+                              && std::memcmp(buffer + 1, "0.00", 4) == 0;
+    const char *text = negativeZero ? buffer + 1 : buffer;
+    const int size = negativeZero ? length - 1 : length;
+
+    Row &r = rows[row];
+    if (size == r.length && std::memcmp(r.text, text, size) == 0)
+        return;  // Te same cyfry - bez rysowania
+
+    std::memcpy(r.text, text, size);
+    r.length = size;
+    update(valueRect(row));
+}
+
+// Ustawienie wartosci wielu wierszy
+void ValueReadout::setValues(const float *values, int count) {
+    count = qMin(count, static_cast<int>(rows.size()));
+    for (int i = 0; i < count; ++i) {
+        setValue(i, values[i]);
+    }
+}
+
+// Przeliczenie szerokosci kolumn i polozenia wierszy
+void ValueReadout::recomputeLayout() {
+    const QFontMetrics fm(font());
+
+    nameWidth = 0;
+    unitWidth = 0;
+    for (const Row &row : rows) {
+        nameWidth = qMax(nameWidth, fm.horizontalAdvance(row.name));
+        unitWidth = qMax(unitWidth, fm.horizontalAdvance(row.unit));
+    }
+
+    // Pole wartosci miesci najdluzszy typowy odczyt
+    valueWidth = qMax(50, fm.horizontalAdvance(QStringLiteral("-0000.00"))) + 2 * (padding + 1);
+    rowHeight = fm.height() + 2 * (padding + 1);
+
+    int y = 0;
+    for (Row &row : rows) {
+        row.top = y;
+        y += rowHeight + spacing;
+        if (row.separator) y += separatorHeight;
+    }
+    if (!rows.isEmpty()) y -= spacing;
+
+    hint = QSize(nameWidth + valueWidth + unitWidth + 2 * spacing, qMax(0, y));
+    updateGeometry();
+    update();
+}
+
+// Prostokat pola wartosci
+QRect ValueReadout::valueRect(int row) const {
+    return QRect(nameWidth + spacing, rows[row].top, valueWidth, rowHeight);
+}
+
+QSize ValueReadout::sizeHint() const {
+    return hint;
+}
+
+QSize ValueReadout::minimumSizeHint() const {
+    return hint;
+}
+
+// Zmiana czcionki - nowa geometria
+void ValueReadout::changeEvent(QEvent *event) {
+    if (event->type() == QEvent::FontChange)
+        recomputeLayout();
+    QWidget::changeEvent(event);
+}
+
+// Rysowanie wierszy
+void ValueReadout::paintEvent(QPaintEvent *event) {
+    QPainter painter(this);
+    const QRect dirty = event->rect();
+
+    for (int i = 0; i < rows.size(); ++i) {
+        const Row &row = rows[i];
+        const QRect rowRect(0, row.top, width(), rowHeight);
+        if (!rowRect.intersects(dirty) && !(row.separator && dirty.bottom() > rowRect.bottom()))
+            continue;
+
+        // Nazwa i jednostka
+        painter.setPen(Qt::white);
+        painter.drawText(QRect(0, row.top, nameWidth, rowHeight), Qt::AlignCenter, row.name);
+        painter.drawText(QRect(nameWidth + valueWidth + 2 * spacing, row.top, unitWidth, rowHeight),
+                         Qt::AlignLeft | Qt::AlignVCenter, row.unit);
+
+        // Pole wartosci
+        const QRect box = valueRect(i);
+        painter.setPen(Qt::black);
+        painter.setBrush(Qt::gray);
+        painter.drawRect(box.adjusted(0, 0, -1, -1));
+
+        painter.setPen(Qt::white);
+        painter.drawText(box.adjusted(padding + 1, 0, -(padding + 1), 0), Qt::AlignRight | Qt::AlignVCenter,
+                         QString::fromLatin1(row.text, row.length));
+
+        // Linia oddzielajaca grupy wierszy (wklesla, jak QFrame::HLine)
+        if (row.separator) {
+            const int y = row.top + rowHeight + spacing + separatorHeight / 2 - 1;
+            painter.setPen(palette().color(QPalette::Dark));
+            painter.drawLine(0, y, width() - 1, y);
+            painter.setPen(palette().color(QPalette::Light));
+            painter.drawLine(0, y + 1, width() - 1, y + 1);
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file    ValueReadout.h
+ * @brief   Painted multi-row numeric readout
+ *
+ * @details Lightweight replacement for a grid of styled QLabels showing
+ *          frequently changing numbers:
+ *          - Values are formatted with std::to_chars into fixed buffers
+ *            (integer to_chars fallback where float to_chars is missing)
+ *          - Only rows whose displayed digits changed are repainted
+ *          - The geometry depends on fonts and captions only, so value
+ *            updates never trigger a relayout
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef VALUEREADOUT_H
+#define VALUEREADOUT_H
+
+#include <QWidget>
+#include <QString>
+#include <QVector>
+
+/**
+ * @class ValueReadout
+ * @brief Rows of "name [value] unit" drawn by a single widget
+ *
+ * @details Each row shows a caption, a boxed right-aligned value with a
+ *          fixed number of decimals and a unit. Rows can be separated into
+ *          groups by horizontal lines.
+ */
+class ValueReadout : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs a readout
+     * @param rows Number of value rows
+     * @param parent Parent widget (default: nullptr)
+     */
+    explicit ValueReadout(int rows, QWidget *parent = nullptr);
+
+    /**
+     * @brief Sets the caption and unit of a row
+     * @param row Row index
+     * @param name Caption shown left of the value
+     * @param unit Unit shown right of the value
+     *
+     * @note Changes the widget geometry; intended for setup and retranslation.
+     */
+    void setRow(int row, const QString &name, const QString &unit);
+
+    /**
+     * @brief Draws a separator line below a row
+     * @param row Row index
+     */
+    void setSeparatorAfter(int row);
+
+    /**
+     * @brief Sets the value of one row
+     * @param row Row index
+     * @param value New value
+     *
+     * @details Repaints the value box only if the formatted text changed.
+     */
+    void setValue(int row, float value);
+
+    /**
+     * @brief Sets the values of the first @p count rows
+     * @param values Array of at least @p count values
+     * @param count Number of values
+     */
+    void setValues(const float *values, int count);
+
+    /**
+     * @brief Provides the size needed by all rows
+     */
+    QSize sizeHint() const override;
+
+    /**
+     * @brief Same as sizeHint(); the readout does not shrink
+     */
+    QSize minimumSizeHint() const override;
+
+protected:
+    /**
+     * @brief Draws captions, value boxes and separators
+     * @param event Qt paint event object
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+    /**
+     * @brief Recomputes the geometry when the font changes
+     * @param event Qt change event object
+     */
+    void changeEvent(QEvent *event) override;
+
+private:
+    static constexpr int maxChars = 16;   ///< Capacity of a formatted value
+    static constexpr int decimals = 2;    ///< Digits after the decimal point
+    static constexpr int padding = 3;     ///< Space between value box border and text
+    static constexpr int spacing = 5;     ///< Space between columns and rows
+    static constexpr int separatorHeight = 6; ///< Vertical space taken by a separator
+
+    /**
+     * @struct Row
+     * @brief State of one readout row
+     */
+    struct Row {
+        QString name;             ///< Caption
+        QString unit;             ///< Unit
+        char text[maxChars];      ///< Formatted value
+        int length = 0;           ///< Used characters of text
+        bool separator = false;   ///< Separator line below the row
+        int top = 0;              ///< Y coordinate of the row
+    };
+
+    QVector<Row> rows;    ///< All rows
+    int nameWidth = 0;    ///< Width of the caption column
+    int valueWidth = 0;   ///< Width of the value box
+    int unitWidth = 0;    ///< Width of the unit column
+    int rowHeight = 0;    ///< Height of one row
+    QSize hint;           ///< Cached size hint
+
+    /**
+     * @brief Recomputes column widths, row positions and the size hint
+     */
+    void recomputeLayout();
+
+    /**
+     * @brief Rectangle of the value box of a row
+     */
+    QRect valueRect(int row) const;
+};
+
+#endif // VALUEREADOUT_H
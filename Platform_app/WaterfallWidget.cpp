@@ -0,0 +1,97 @@
+#include "WaterfallWidget.h"
+#include <QPainter>
+
+#include <algorithm>
+
+// Konstruktor - paleta interpolowana miedzy punktami czarny -> niebieski -> czerwony -> zolty -> bialy
+WaterfallWidget::WaterfallWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    struct Stop { float at; float r, g, b; };
+    const Stop stops[] = {
+        { 0.00f,   0.0f,   0.0f,   0.0f },
+        { 0.30f,   0.0f,   0.0f, 200.0f },
+        { 0.60f, 220.0f,   0.0f,  60.0f },
+        { 0.85f, 255.0f, 220.0f,   0.0f },
+        { 1.00f, 255.0f, 255.0f, 255.0f },
+    };
+
+    m_palette.resize(256);
+    int stop = 0;
+    for (int i = 0; i < 256; ++i) {
+        const float t = i / 255.0f;
+        while (t > stops[stop + 1].at)
+            ++stop;
+        const Stop &a = stops[stop];
+        const Stop &b = stops[stop + 1];
+        const float f = (t - a.at) / (b.at - a.at);
+        m_palette[i] = qRgb(static_cast<int>(a.r + f * (b.r - a.r)),
+                            static_cast<int>(a.g + f * (b.g - a.g)),
+                            static_cast<int>(a.b + f * (b.b - a.b)));
+    }
+
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    setMinimumHeight(120);
+}
+
+void WaterfallWidget::setRange(float minDb, float maxDb)
+{
+    if (maxDb <= minDb) return;
+    m_minDb = minDb;
+    m_maxDb = maxDb;
+}
+
+// Nowy wiersz - zapis jednej linii obrazu
+void WaterfallWidget::addRow(const float *decibels, int bins)
+{
+    if (bins <= 0) return;
+
+    if (m_image.width() != bins) {
+        m_image = QImage(bins, kRows, QImage::Format_RGB32);
+        m_image.fill(m_palette[0]);
+        m_newestRow = kRows;
+        m_rowCount = 0;
+    }
+
+    // Pierscien wypelniany od dolu obrazu w gore: starsze wiersze leza ponizej nowszych
+    m_newestRow = (m_newestRow + kRows - 1) % kRows;
+    m_rowCount = std::min(m_rowCount + 1, kRows);
+
+    QRgb *line = reinterpret_cast<QRgb*>(m_image.scanLine(m_newestRow));
+    const float scale = 255.0f / (m_maxDb - m_minDb);
+    for (int bin = 0; bin < bins; ++bin) {
+        const float level = (decibels[bin] - m_minDb) * scale;
+        line[bin] = m_palette[static_cast<int>(std::clamp(level, 0.0f, 255.0f))];
+    }
+    update();
+}
+
+void WaterfallWidget::clear()
+{
+    m_image = QImage();
+    m_newestRow = kRows;
+    m_rowCount = 0;
+    update();
+}
+
+// Rysowanie pierscienia w dwoch czesciach, bez kopiowania obrazu
+void WaterfallWidget::paintEvent(QPaintEvent *)
+{
+    QPainter painter(this);
+    painter.fillRect(rect(), m_palette[0]);
+    if (m_rowCount == 0) return;
+
+    const double rowHeight = static_cast<double>(height()) / kRows;
+
+    // Od najnowszego wiersza do konca obrazu - gora widgetu
+    const int upper = std::min(m_rowCount, kRows - m_newestRow);
+    painter.drawImage(QRectF(0, 0, width(), rowHeight * upper),
+                      m_image, QRectF(0, m_newestRow, m_image.width(), upper));
+
+    // Najstarsze wiersze z poczatku obrazu - ponizej
+    const int lower = m_rowCount - upper;
+    if (lower > 0) {
+        painter.drawImage(QRectF(0, rowHeight * upper, width(), rowHeight * lower),
+                          m_image, QRectF(0, 0, m_image.width(), lower));
+    }
+}
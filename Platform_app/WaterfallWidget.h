@@ -0,0 +1,75 @@
+/**
+ * @file    WaterfallWidget.h
+ * @brief   Scrolling spectrogram of successive spectra
+ *
+ * @details Each spectrum becomes one row of colour-mapped pixels:
+ *          - Rows are kept in a QImage used as a ring, adding a row writes
+ *            one scan line, nothing is shifted
+ *          - The colour map is a 256-entry table built once
+ *          - The newest row is drawn at the top
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#ifndef WATERFALLWIDGET_H
+#define WATERFALLWIDGET_H
+
+#include <QWidget>
+#include <QImage>
+#include <QVector>
+#include <QRgb>
+
+/**
+ * @class WaterfallWidget
+ * @brief Time/frequency intensity plot (frequency across, time downwards)
+ */
+class WaterfallWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructs an empty waterfall
+     * @param parent Parent widget (default: nullptr)
+     */
+    explicit WaterfallWidget(QWidget *parent = nullptr);
+
+    /**
+     * @brief Sets the colour scale
+     * @param minDb Level drawn with the darkest colour
+     * @param maxDb Level drawn with the brightest colour
+     */
+    void setRange(float minDb, float maxDb);
+
+    /**
+     * @brief Appends one spectrum as the newest row
+     * @param decibels Amplitudes per bin
+     * @param bins Number of bins; a different count than before clears the plot
+     */
+    void addRow(const float *decibels, int bins);
+
+    /**
+     * @brief Removes all rows
+     */
+    void clear();
+
+protected:
+    /**
+     * @brief Draws the ring of rows, newest at the top
+     */
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    static constexpr int kRows = 256;   ///< Spectra kept
+
+    QImage m_image;                     ///< Ring of rows, one pixel per bin
+    QVector<QRgb> m_palette;            ///< Colour per level step
+    int m_newestRow = kRows;            ///< Scan line of the newest row (rows fill upwards)
+    int m_rowCount = 0;                 ///< Valid rows
+    float m_minDb = -100.0f;            ///< Darkest level
+    float m_maxDb = 0.0f;               ///< Brightest level
+};
+
+#endif // WATERFALLWIDGET_H
@@ -0,0 +1,109 @@
+/**
+ * @file    convert_bench.cpp
+ * @brief   Throughput of raw IMU sample conversion to SI units
+ *
+ * @details Converts the same random samples with:
+ *          - the legacy per-value expressions from the GUI
+ *          - convertImuBlock() on packed int16 blocks
+ *          - convertImuBlock() on PlatformSample arrays (strided)
+ *          and reports millions of samples per second. The kernel output is
+ *          compared against the scalar reference first.
+ *
+ * Usage: convert_bench [samples]
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "ImuConversion.h"
+#include "PlatformSample.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Zapobiega usunieciu petli przez optymalizator
+volatile float g_sink = 0.0f;
+
+using Profile = DefaultImuProfile;
+
+// Dotychczasowe skalowanie z MainWindow::readSerialData()
+void legacyConvert(const int16_t *raw, float *out, std::size_t samples)
+{
+    for (std::size_t i = 0; i < samples; ++i, raw += 6, out += 6) {
+        out[0] = raw[0] * 0.000565f;
+        out[1] = raw[1] * 0.000565f;
+        out[2] = raw[2] * 0.000565f;
+        out[3] = raw[3] / 65.5f * static_cast<float>(M_PI) / 180.0f;
+        out[4] = raw[4] / 65.5f * static_cast<float>(M_PI) / 180.0f;
+        out[5] = raw[5] / 65.5f * static_cast<float>(M_PI) / 180.0f;
+    }
+}
+
+// Czas wykonania w sekundach (najlepszy z kilku przebiegow)
+template <typename Function>
+double measure(Function &&function, int repeats = 5)
+{
+    double best = 1e30;
+    for (int r = 0; r < repeats; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() < best) best = elapsed.count();
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::size_t samples = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000003;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> value(-32768, 32767);
+
+    std::vector<int16_t> packed(samples * 6);
+    std::vector<PlatformSample> records(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+        for (int c = 0; c < 6; ++c) {
+            packed[i * 6 + c] = static_cast<int16_t>(value(rng));
+            records[i].values[c] = packed[i * 6 + c];
+        }
+    }
+
+    std::vector<float> out(samples * 6);
+    std::vector<float> reference(samples * 6);
+
+    // Poprawnosc wzgledem wzoru skalarnego
+    for (std::size_t i = 0; i < samples * 6; ++i)
+        reference[i] = packed[i] * ((i % 6) < 3 ? Profile::accelScale : Profile::gyroScale);
+
+    const std::size_t stride = sizeof(PlatformSample) / sizeof(int16_t);
+    convertImuBlock<Profile>(packed.data(), 6, out.data(), samples);
+    const bool packedOk = out == reference;
+    convertImuBlock<Profile>(records[0].values, stride, out.data(), samples);
+    const bool stridedOk = out == reference;
+    std::printf("kernel: %s, packed %s, strided %s\n", imuConversionIsa(),
+                packedOk ? "ok" : "MISMATCH", stridedOk ? "ok" : "MISMATCH");
+
+    const double legacy = measure([&] { legacyConvert(packed.data(), out.data(), samples); g_sink = out[samples]; });
+    const double block = measure([&] { convertImuBlock<Profile>(packed.data(), 6, out.data(), samples); g_sink = out[samples]; });
+    const double strided = measure([&] {
+        convertImuBlock<Profile>(records[0].values, stride, out.data(), samples);
+        g_sink = out[samples];
+    });
+
+    std::printf("%-10s %12s %10s\n", "path", "Msamples/s", "ns/sample");
+    std::printf("%-10s %12.1f %10.2f\n", "legacy", samples / legacy * 1e-6, legacy * 1e9 / samples);
+    std::printf("%-10s %12.1f %10.2f\n", "packed", samples / block * 1e-6, block * 1e9 / samples);
+    std::printf("%-10s %12.1f %10.2f\n", "strided", samples / strided * 1e-6, strided * 1e9 / samples);
+
+    return packedOk && stridedOk ? 0 : 1;
+}
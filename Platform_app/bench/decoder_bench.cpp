@@ -0,0 +1,181 @@
+/**
+ * @file    decoder_bench.cpp
+ * @brief   Per-frame cost of ASCII frame decoding and CRC-8 validation
+ *
+ * @details Decodes the same corpus of valid IMU and servo frames with:
+ *          - the legacy path (split/toInt + bit-by-bit CRC, fields converted twice)
+ *          - FrameDecoder (single pass, table-driven CRC)
+ *          and reports nanoseconds per frame. A corrupted corpus is then run
+ *          through both decoders to confirm they accept the same frames.
+ *
+ * Usage: decoder_bench [frames]
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "Crc8.h"
+#include "FrameDecoder.h"
+
+#include <QByteArray>
+#include <QList>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Zapobiega usunieciu petli przez optymalizator
+volatile int64_t g_sink = 0;
+
+// Dotychczasowa suma kontrolna (bit po bicie, konwersja pol przez toInt)
+uint8_t legacyCrc8(const QList<QByteArray> &data)
+{
+    uint8_t crc = 0xFF;
+    const uint8_t poly = 0x31;
+
+    for (const QByteArray &valStr : data) {
+        bool ok;
+        int16_t value = valStr.toInt(&ok);
+        if (!ok) return 0;
+
+        uint8_t lsb = static_cast<uint8_t>(value & 0xFF);
+        uint8_t msb = static_cast<uint8_t>((value >> 8) & 0xFF);
+
+        for (uint8_t byte : {lsb, msb}) {
+            crc ^= byte;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc = (crc & 0x80) ? ((crc << 1) ^ poly) : (crc << 1);
+            }
+        }
+    }
+    return crc;
+}
+
+// Dotychczasowe dekodowanie linii z MainWindow::readSerialData()
+bool legacyDecode(const QByteArray &line, PlatformSample &sample)
+{
+    const bool imu = line.startsWith("IMU:") && line.contains('*');
+    const bool servo = !imu && line.startsWith("S:") && line.contains('*');
+    if (!imu && !servo) return false;
+
+    const int prefix = imu ? 4 : 2;
+    const int fields = imu ? 7 : 6;
+    const int crcPos = line.lastIndexOf('*');
+    const QByteArray dataPart = line.mid(prefix, crcPos - prefix);
+    const QByteArray crcPart = line.mid(crcPos + 1);
+
+    bool crcOk;
+    const uint8_t receivedCrc = crcPart.toUInt(&crcOk, 16);
+    if (!crcOk || crcPart.length() != 2) return false;
+
+    const QList<QByteArray> values = dataPart.split(',');
+    if (values.size() != fields) return false;
+
+    if (receivedCrc != legacyCrc8(imu ? values.mid(1, 6) : values)) return false;
+
+    bool conversionOk[7];
+    const int first = imu ? 1 : 0;
+    if (imu) sample.imuId = values[0].toInt(&conversionOk[0]);
+    for (int i = 0; i < 6; ++i)
+        sample.values[i] = static_cast<int16_t>(values[i + first].toInt(&conversionOk[i + first]));
+    return std::all_of(conversionOk, conversionOk + fields, [](bool ok) { return ok; });
+}
+
+// Poprawne ramki z wlasciwa suma kontrolna
+std::vector<std::string> makeFrames(std::size_t count, std::mt19937 &rng)
+{
+    std::uniform_int_distribution<int> value(-32768, 32767);
+    std::vector<std::string> frames;
+    frames.reserve(count);
+    char line[128];
+    for (std::size_t i = 0; i < count; ++i) {
+        int16_t v[6];
+        for (int16_t &x : v) x = static_cast<int16_t>(i % 3 == 2 ? value(rng) % 90 : value(rng));
+        const uint8_t crc = crc8Int16(v, 6);
+        if (i % 3 == 2) {
+            std::snprintf(line, sizeof(line), "S:%d,%d,%d,%d,%d,%d*%02X",
+                          v[0], v[1], v[2], v[3], v[4], v[5], crc);
+        } else {
+            std::snprintf(line, sizeof(line), "IMU:%d,%d,%d,%d,%d,%d,%d*%02X",
+                          int(i % 2) + 1, v[0], v[1], v[2], v[3], v[4], v[5], crc);
+        }
+        frames.emplace_back(line);
+    }
+    return frames;
+}
+
+// Uszkodzenie losowych znakow ramek
+std::vector<std::string> corrupt(std::vector<std::string> frames, std::mt19937 &rng)
+{
+    const char alphabet[] = "0123456789abcdefABCDEF,*+- \t:ISMUx";
+    std::uniform_int_distribution<int> pick(0, sizeof(alphabet) - 2);
+    for (std::string &f : frames) {
+        const int edits = 1 + static_cast<int>(rng() % 3);
+        for (int e = 0; e < edits && !f.empty(); ++e) {
+            const std::size_t pos = rng() % f.size();
+            switch (rng() % 3) {
+            case 0: f[pos] = alphabet[pick(rng)]; break;
+            case 1: f.erase(pos, 1); break;
+            default: f.insert(pos, 1, alphabet[pick(rng)]); break;
+            }
+        }
+    }
+    return frames;
+}
+
+template <typename Fn>
+double nsPerFrame(const std::vector<std::string> &frames, Fn decode)
+{
+    int64_t accepted = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const std::string &f : frames) {
+        PlatformSample sample;
+        if (decode(f, sample)) accepted += sample.values[0];
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    g_sink = accepted;
+    return ns / frames.size();
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::mt19937 rng(4321);
+    const std::vector<std::string> frames = makeFrames(count, rng);
+
+    auto legacy = [](const std::string &f, PlatformSample &s) {
+        return legacyDecode(QByteArray::fromRawData(f.data(), static_cast<int>(f.size())), s);
+    };
+    auto single = [](const std::string &f, PlatformSample &s) {
+        return FrameDecoder::decode(f, s).status == FrameDecoder::Status::Ok;
+    };
+
+    std::printf("frames: %zu\n", count);
+    std::printf("%-14s %8.1f ns/frame\n", "legacy", nsPerFrame(frames, legacy));
+    std::printf("%-14s %8.1f ns/frame\n", "FrameDecoder", nsPerFrame(frames, single));
+
+    // Zgodnosc akceptowanych ramek na uszkodzonym korpusie
+    const std::vector<std::string> damaged = corrupt(frames, rng);
+    std::size_t mismatches = 0;
+    std::size_t acceptedCount = 0;
+    for (const std::string &f : damaged) {
+        PlatformSample a;
+        PlatformSample b;
+        const bool okLegacy = legacy(f, a);
+        const bool okSingle = single(f, b);
+        acceptedCount += okSingle;
+        if (okLegacy != okSingle || (okLegacy && (a.imuId != b.imuId || !std::equal(a.values, a.values + 6, b.values)))) {
+            if (++mismatches <= 10) std::printf("mismatch: %s\n", f.c_str());
+        }
+    }
+    std::printf("corrupted corpus: %zu accepted, %zu mismatches\n", acceptedCount, mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
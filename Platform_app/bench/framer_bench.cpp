@@ -0,0 +1,122 @@
+/**
+ * @file    framer_bench.cpp
+ * @brief   Throughput benchmark for serial line framing
+ *
+ * @details Compares the legacy QByteArray framing loop (indexOf/left/
+ *          trimmed/remove) against LineFramer on the same synthetic stream
+ *          delivered in serial-sized chunks. Prints lines per second.
+ *
+ * Usage: framer_bench [lines] [chunk_bytes]
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "LineFramer.h"
+
+#include <QByteArray>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+namespace {
+
+// Zapobiega usunieciu petli przez optymalizator
+volatile std::size_t g_sink = 0;
+
+// Generowanie strumienia linii IMU i serw
+std::string makeCorpus(std::size_t lines)
+{
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> value(-32768, 32767);
+    std::string out;
+    out.reserve(lines * 48);
+    char line[128];
+    for (std::size_t i = 0; i < lines; ++i) {
+        if (i % 3 == 2) {
+            std::snprintf(line, sizeof(line), "S:%d,%d,%d,%d,%d,%d*%02X\r\n",
+                          value(rng) % 90, value(rng) % 90, value(rng) % 90,
+                          value(rng) % 90, value(rng) % 90, value(rng) % 90, value(rng) & 0xFF);
+        } else {
+            std::snprintf(line, sizeof(line), "IMU:%d,%d,%d,%d,%d,%d,%d*%02X\r\n",
+                          int(i % 2) + 1, value(rng), value(rng), value(rng),
+                          value(rng), value(rng), value(rng), value(rng) & 0xFF);
+        }
+        out += line;
+    }
+    return out;
+}
+
+// Dotychczasowy algorytm z MainWindow::readSerialData()
+std::size_t legacyFraming(const std::string &corpus, std::size_t chunk)
+{
+    QByteArray buffer;
+    std::size_t count = 0;
+    std::size_t checksum = 0;
+    for (std::size_t pos = 0; pos < corpus.size(); pos += chunk) {
+        const std::size_t n = std::min(chunk, corpus.size() - pos);
+        buffer += QByteArray(corpus.data() + pos, static_cast<int>(n));
+
+        while (true) {
+            const int lineEnd = buffer.indexOf('\n');
+            if (lineEnd == -1) break;
+
+            QByteArray line = buffer.left(lineEnd).trimmed();
+            buffer.remove(0, lineEnd + 1);
+            if (line.isEmpty()) continue;
+
+            ++count;
+            checksum += static_cast<std::size_t>(line.size());
+        }
+    }
+    g_sink = checksum;
+    return count;
+}
+
+// Nowy framer
+std::size_t lineFramer(const std::string &corpus, std::size_t chunk)
+{
+    LineFramer framer;
+    std::size_t count = 0;
+    std::size_t checksum = 0;
+    for (std::size_t pos = 0; pos < corpus.size(); pos += chunk) {
+        const std::size_t n = std::min(chunk, corpus.size() - pos);
+        framer.append(corpus.data() + pos, n);
+
+        std::string_view line;
+        while (framer.nextLine(line)) {
+            ++count;
+            checksum += line.size();
+        }
+    }
+    g_sink = checksum;
+    return count;
+}
+
+template <typename Fn>
+void run(const char *name, Fn fn, const std::string &corpus, std::size_t chunk)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t lines = fn(corpus, chunk);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%-14s %10zu lines  %8.3f ms  %12.0f lines/s\n",
+                name, lines, seconds * 1e3, lines / seconds);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const std::size_t lines = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const std::size_t chunk = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 512;
+
+    const std::string corpus = makeCorpus(lines);
+    std::printf("corpus: %zu lines, %zu bytes, chunk %zu bytes\n", lines, corpus.size(), chunk);
+
+    run("legacy", legacyFraming, corpus, chunk);
+    run("LineFramer", lineFramer, corpus, chunk);
+    return 0;
+}
@@ -0,0 +1,449 @@
+/**
+ * @file    platform_bench.cpp
+ * @brief   Benchmark suite of the platform_core library
+ *
+ * @details Measures the ingestion path without Qt on fixed corpora:
+ *          - synthetic ASCII and binary streams generated from a seed
+ *          - optional recordings: a raw byte capture of the serial port
+ *            and/or a session file, re-encoded in both wire formats
+ *          Every benchmark runs once untimed and then --repeat times; the
+ *          median and the best run are reported as ns per item, together
+ *          with items per second, MB/s and heap allocations per item
+ *          (counted by replacing the global operator new). Decoded frame
+ *          counts are checked against the corpus, so a functional
+ *          regression fails the run (exit code 1).
+ *
+ * Usage: platform_bench [--frames N] [--repeat R] [--seed S] [--chunk BYTES]
+ *                       [--capture FILE] [--session FILE] [--filter TEXT] [--csv]
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "BinaryProtocol.h"
+#include "Crc16.h"
+#include "FrameDecoder.h"
+#include "FrameSchema.h"
+#include "ImuConversion.h"
+#include "ImuStatistics.h"
+#include "LineFramer.h"
+#include "RealFft.h"
+#include "SessionFormat.h"
+#include "SpscQueue.h"
+#include "StreamDecoder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// === Licznik alokacji (globalny operator new) ===
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// Zapobiega usunieciu petli przez optymalizator
+volatile int64_t g_sink = 0;
+
+struct Options {
+    std::size_t frames = 200000;    // Ramki korpusu syntetycznego
+    int repeat = 5;                 // Mierzone przebiegi
+    unsigned seed = 1;              // Ziarno korpusu
+    std::size_t chunk = 4096;       // Porcja bajtow jak z jednego odczytu portu
+    std::string capture;            // Surowe bajty z portu (opcjonalnie)
+    std::string session;            // Plik sesji (opcjonalnie)
+    std::string filter;             // Tylko testy zawierajace ten tekst
+    bool csv = false;               // Wyniki jako CSV
+};
+
+// Wynik jednego testu
+struct Measurement {
+    std::string name;
+    uint64_t items = 0;             // Elementy w jednym przebiegu
+    uint64_t bytes = 0;             // Bajty w jednym przebiegu (0 = nie dotyczy)
+    std::vector<double> seconds;    // Czas kazdego przebiegu
+    uint64_t allocations = 0;       // Alokacje we wszystkich przebiegach
+    bool ok = true;                 // Liczba zdekodowanych ramek zgodna z korpusem
+};
+
+void usage()
+{
+    std::fprintf(stderr,
+                 "Usage: platform_bench [options]\n"
+                 "  --frames N       synthetic frames per corpus (default 200000)\n"
+                 "  --repeat R       measured runs per benchmark (default 5)\n"
+                 "  --seed S         seed of the synthetic corpus (default 1)\n"
+                 "  --chunk BYTES    bytes per simulated port read (default 4096)\n"
+                 "  --capture FILE   raw serial capture to decode (ASCII or binary)\n"
+                 "  --session FILE   session recording, re-encoded in both formats\n"
+                 "  --filter TEXT    run only benchmarks whose name contains TEXT\n"
+                 "  --csv            machine readable output\n");
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--frames" && hasValue) options.frames = std::strtoul(argv[++i], nullptr, 10);
+        else if (arg == "--repeat" && hasValue) options.repeat = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--seed" && hasValue) options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--chunk" && hasValue) options.chunk = std::max<std::size_t>(1, std::strtoul(argv[++i], nullptr, 10));
+        else if (arg == "--capture" && hasValue) options.capture = argv[++i];
+        else if (arg == "--session" && hasValue) options.session = argv[++i];
+        else if (arg == "--filter" && hasValue) options.filter = argv[++i];
+        else if (arg == "--csv") options.csv = true;
+        else return false;
+    }
+    return options.frames > 0;
+}
+
+// === Korpusy ===
+
+// Probki jak z platformy: dwa IMU i co dziesiata ramka serw.
+// Tylko surowe wyjscie mt19937 - ten sam korpus na kazdej bibliotece standardowej.
+std::vector<PlatformSample> syntheticSamples(std::size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<PlatformSample> samples(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        PlatformSample &s = samples[i];
+        if (i % 10 == 9) {
+            s.type = PlatformSample::Type::Servo;
+            for (int16_t &v : s.values) v = static_cast<int16_t>(static_cast<int>(rng() % 181) - 90);
+        } else {
+            s.type = PlatformSample::Type::Imu;
+            s.imuId = 1 + static_cast<int32_t>(i % 2);
+            for (int16_t &v : s.values) v = static_cast<int16_t>(static_cast<int>(rng() % 32768) - 16384);
+        }
+        s.timestampNs = static_cast<int64_t>(i) * 250000;
+    }
+    return samples;
+}
+
+std::string encodeAscii(const std::vector<PlatformSample> &samples)
+{
+    std::string out;
+    out.reserve(samples.size() * 48);
+    char line[96];
+    for (const PlatformSample &s : samples) {
+        const std::size_t n = formatSample(AsciiFrames(), s, 0, line, sizeof(line));
+        out.append(line, n);
+        out.append("\r\n");
+    }
+    return out;
+}
+
+std::string encodeBinary(const std::vector<PlatformSample> &samples)
+{
+    std::string out;
+    out.reserve(samples.size() * BinaryProtocol::kMaxFrameSize);
+    uint8_t frame[BinaryProtocol::kMaxFrameSize];
+    uint16_t sequence = 0;
+    for (const PlatformSample &s : samples) {
+        const std::size_t n = BinaryProtocol::encode(s, sequence++, frame);
+        out.append(reinterpret_cast<const char *>(frame), n);
+    }
+    return out;
+}
+
+// Rekordy do separatora (bez pustych; linie tekstowe bez "\r")
+std::vector<std::string_view> splitRecords(const std::string &stream, char delimiter)
+{
+    std::vector<std::string_view> records;
+    std::size_t start = 0;
+    while (start < stream.size()) {
+        std::size_t end = stream.find(delimiter, start);
+        if (end == std::string::npos) end = stream.size();
+        std::string_view record(stream.data() + start, end - start);
+        if (delimiter == '\n' && !record.empty() && record.back() == '\r') record.remove_suffix(1);
+        if (!record.empty()) records.push_back(record);
+        start = end + 1;
+    }
+    return records;
+}
+
+bool readFile(const std::string &path, std::string &data)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Odczyt pliku sesji bez Qt - do pierwszego uszkodzonego fragmentu
+bool readSession(const std::string &path, std::vector<PlatformSample> &samples)
+{
+    std::ifstream file(path, std::ios::binary);
+    SessionFileHeader header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))
+        || std::memcmp(header.magic, kSessionMagic, sizeof(header.magic)) != 0
+        || header.version != kSessionVersion || header.recordSize != sizeof(SessionRecord))
+        return false;
+
+    SessionChunkHeader chunk;
+    std::vector<SessionRecord> records;
+    while (file.read(reinterpret_cast<char *>(&chunk), sizeof(chunk)) && chunk.magic == kSessionChunkMagic) {
+        records.resize(chunk.count);
+        const std::size_t payload = records.size() * sizeof(SessionRecord);
+        if (!file.read(reinterpret_cast<char *>(records.data()), static_cast<std::streamsize>(payload))
+            || crc16(reinterpret_cast<const uint8_t *>(records.data()), payload) != chunk.crc)
+            break;
+        for (const SessionRecord &record : records)
+            samples.push_back(fromSessionRecord(record));
+    }
+    return true;
+}
+
+// === Pomiar ===
+
+// Test uruchamiany raz bez pomiaru i repeat razy z pomiarem;
+// run() zwraca liczbe poprawnie przetworzonych elementow.
+Measurement measure(const Options &options, const std::string &name, uint64_t items, uint64_t bytes,
+                    uint64_t expected, const std::function<uint64_t()> &run)
+{
+    Measurement m;
+    m.name = name;
+    m.items = items;
+    m.bytes = bytes;
+    m.seconds.reserve(static_cast<std::size_t>(options.repeat));
+
+    m.ok = (run() == expected);
+    const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    for (int r = 0; r < options.repeat; ++r) {
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t processed = run();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        m.seconds.push_back(elapsed.count());
+        m.ok = m.ok && (processed == expected);
+    }
+    m.allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    return m;
+}
+
+void printHeader(const Options &options)
+{
+    if (options.csv) {
+        std::printf("benchmark,items,ns_per_item_median,ns_per_item_min,mitems_per_s,mb_per_s,allocs_per_item,ok\n");
+        return;
+    }
+    std::printf("platform_bench: frames=%zu repeat=%d seed=%u chunk=%zu isa=%s\n",
+                options.frames, options.repeat, options.seed, options.chunk, imuConversionIsa());
+    std::printf("%-24s %10s %12s %12s %10s %9s %12s\n",
+                "benchmark", "items", "ns/item med", "ns/item min", "Mitems/s", "MB/s", "allocs/item");
+}
+
+void printMeasurement(const Options &options, Measurement m)
+{
+    std::sort(m.seconds.begin(), m.seconds.end());
+    const double median = m.seconds[m.seconds.size() / 2];
+    const double best = m.seconds.front();
+    const double items = static_cast<double>(std::max<uint64_t>(m.items, 1));
+    const double nsMedian = median * 1e9 / items;
+    const double nsBest = best * 1e9 / items;
+    const double itemsPerSecond = items / median / 1e6;
+    const double megabytes = m.bytes ? m.bytes / median / 1e6 : 0.0;
+    const double allocations = static_cast<double>(m.allocations) / (items * static_cast<double>(m.seconds.size()));
+
+    if (options.csv) {
+        std::printf("%s,%llu,%.3f,%.3f,%.4f,%.2f,%.6f,%d\n", m.name.c_str(),
+                    static_cast<unsigned long long>(m.items), nsMedian, nsBest, itemsPerSecond,
+                    megabytes, allocations, m.ok ? 1 : 0);
+        return;
+    }
+    std::printf("%-24s %10llu %12.1f %12.1f %10.2f %9.1f %12.6f%s\n", m.name.c_str(),
+                static_cast<unsigned long long>(m.items), nsMedian, nsBest, itemsPerSecond,
+                megabytes, allocations, m.ok ? "" : "  FAIL (frame count)");
+}
+
+// === Testy ===
+
+// Dekodowanie strumienia w porcjach jak z portu; zwraca poprawne ramki
+uint64_t decodeStream(StreamDecoder &decoder, const std::string &stream, std::size_t chunk)
+{
+    decoder.reset();
+    uint64_t frames = 0;
+    PlatformSample sample;
+    for (std::size_t offset = 0; offset < stream.size(); offset += chunk) {
+        decoder.append(stream.data() + offset, std::min(chunk, stream.size() - offset));
+        for (auto r = decoder.next(sample); r.status != StreamDecoder::Status::NeedMoreData; r = decoder.next(sample)) {
+            if (r.status == StreamDecoder::Status::Ok) ++frames;
+        }
+    }
+    return frames;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    // Korpusy wejsciowe
+    const std::vector<PlatformSample> samples = syntheticSamples(options.frames, options.seed);
+    const std::string ascii = encodeAscii(samples);
+    const std::string binary = encodeBinary(samples);
+    const std::vector<std::string_view> lines = splitRecords(ascii, '\n');
+    const std::vector<std::string_view> records = splitRecords(binary, '\0');
+
+    std::string capture;
+    if (!options.capture.empty() && !readFile(options.capture, capture)) {
+        std::fprintf(stderr, "Cannot read capture %s\n", options.capture.c_str());
+        return 2;
+    }
+    std::vector<PlatformSample> session;
+    if (!options.session.empty() && !readSession(options.session, session)) {
+        std::fprintf(stderr, "Not a session file: %s\n", options.session.c_str());
+        return 2;
+    }
+
+    std::vector<Measurement> results;
+    auto add = [&](const std::string &name, uint64_t items, uint64_t bytes, uint64_t expected,
+                   const std::function<uint64_t()> &run) {
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) return;
+        results.push_back(measure(options, name, items, bytes, expected, run));
+    };
+
+    // Ramkowanie linii
+    LineFramer framer;
+    add("framer.ascii", lines.size(), ascii.size(), lines.size(), [&]() {
+        framer.reset();
+        uint64_t count = 0;
+        std::string_view line;
+        for (std::size_t offset = 0; offset < ascii.size(); offset += options.chunk) {
+            framer.append(ascii.data() + offset, std::min(options.chunk, ascii.size() - offset));
+            while (framer.nextLine(line))
+                ++count;
+        }
+        return count;
+    });
+
+    // Dekodowanie pojedynczych ramek
+    add("decode.ascii", lines.size(), ascii.size(), lines.size(), [&]() {
+        uint64_t count = 0;
+        PlatformSample sample;
+        for (std::string_view line : lines)
+            count += FrameDecoder::decode(line, sample).status == FrameDecoder::Status::Ok;
+        g_sink = sample.values[0];
+        return count;
+    });
+    add("decode.binary", records.size(), binary.size(), records.size(), [&]() {
+        uint64_t count = 0;
+        PlatformSample sample;
+        for (std::string_view record : records)
+            count += BinaryProtocol::decode(record, sample).status == BinaryProtocol::Status::Ok;
+        g_sink = sample.values[0];
+        return count;
+    });
+
+    // Caly tor odbioru: porcje bajtow -> ramkowanie -> wykrycie protokolu -> dekodowanie
+    StreamDecoder decoder;
+    add("stream.ascii", samples.size(), ascii.size(), samples.size(),
+        [&]() { return decodeStream(decoder, ascii, options.chunk); });
+    add("stream.binary", samples.size(), binary.size(), samples.size(),
+        [&]() { return decodeStream(decoder, binary, options.chunk); });
+
+    if (!capture.empty()) {
+        // Liczba ramek nagrania nieznana z gory - wzorcem jest pierwszy przebieg
+        const uint64_t frames = decodeStream(decoder, capture, options.chunk);
+        add("stream.capture", frames, capture.size(), frames,
+            [&]() { return decodeStream(decoder, capture, options.chunk); });
+    }
+    if (!session.empty()) {
+        const std::string sessionAscii = encodeAscii(session);
+        const std::string sessionBinary = encodeBinary(session);
+        add("stream.session.ascii", session.size(), sessionAscii.size(), session.size(),
+            [&]() { return decodeStream(decoder, sessionAscii, options.chunk); });
+        add("stream.session.binary", session.size(), sessionBinary.size(), session.size(),
+            [&]() { return decodeStream(decoder, sessionBinary, options.chunk); });
+    }
+
+    // Konwersja do jednostek SI (probki w ukladzie PlatformSample)
+    std::vector<float> converted(samples.size() * 6);
+    const ImuConverter convert = imuConverter(AccelRange::G2, GyroRange::Dps500);
+    add("convert.imu", samples.size(), 0, samples.size(), [&]() {
+        convert(samples[0].values, sizeof(PlatformSample) / sizeof(int16_t), converted.data(), samples.size());
+        g_sink = static_cast<int64_t>(converted[samples.size() / 2]);
+        return static_cast<uint64_t>(samples.size());
+    });
+
+    // Przekazanie probek miedzy watkami (tu w jednym watku - koszt samej kolejki)
+    SpscQueue<PlatformSample> queue(1024);
+    add("queue.spsc", samples.size(), 0, samples.size(), [&]() {
+        uint64_t count = 0;
+        PlatformSample sample;
+        for (std::size_t i = 0; i < samples.size(); i += 256) {
+            const std::size_t end = std::min(samples.size(), i + 256);
+            for (std::size_t j = i; j < end; ++j)
+                queue.tryPush(samples[j]);
+            while (queue.tryPop(sample))
+                ++count;
+        }
+        return count;
+    });
+
+    // Statystyki wszystkich osi
+    ImuStatistics statistics;
+    statistics.addImu(1);
+    add("stats.update", samples.size(), 0, samples.size(), [&]() {
+        statistics.reset();
+        for (std::size_t i = 0; i < samples.size(); ++i)
+            statistics.updateImu(0, &converted[i * 6], samples[i].timestampNs);
+        return static_cast<uint64_t>(samples.size());
+    });
+
+    // Widmo: jedna transformata 1024 punktow na kazde 512 probek jednej osi
+    RealFft fft(1024);
+    std::vector<float> axis(samples.size() + 1024);
+    for (std::size_t i = 0; i < samples.size(); ++i)
+        axis[i] = converted[i * 6];
+    const uint64_t transforms = samples.size() / 512;
+    add("fft.real1024", transforms, 0, transforms, [&]() {
+        float acc = 0.0f;
+        for (uint64_t t = 0; t < transforms; ++t)
+            acc += fft.transform(&axis[t * 512])[1].real();
+        g_sink = static_cast<int64_t>(acc);
+        return transforms;
+    });
+
+    printHeader(options);
+    bool ok = true;
+    for (const Measurement &m : results) {
+        printMeasurement(options, m);
+        ok = ok && m.ok;
+    }
+    return ok ? 0 : 1;
+}
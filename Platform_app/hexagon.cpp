@@ -1,10 +1,15 @@
 #include "hexagon.h"
 #include <QPainter>
+#include <QPaintEvent>
 #include <QtMath>
 
 // Konstruktor widgetu szesciokata z paskami
 HexagonBars::HexagonBars(QWidget *parent)
-    : QWidget(parent), barValues(6, 0.5f) {  // Inicjalizacja 6 pasków z wartoscia 0.5
+    : QWidget(parent), barValues(6, 0.5f),   // Inicjalizacja 6 pasków z wartoscia 0.5
+      labelFont("Arial", 10, QFont::Bold), labelMetrics(labelFont) {
+    for (int i = 0; i < 6; ++i) {
+        updateLabel(i);  // Teksty katow i ich rozmiary
+    }
     calculateHexagon();  // Wylicz wspolrzedne szesciokata
     setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Expanding);
 }
@@ -12,21 +17,41 @@ HexagonBars::HexagonBars(QWidget *parent)
 // Ustawienie wartosci paska w danym indeksie (0-5)
 void HexagonBars::setBarValue(int index, float value) {
     if (index < 0 || index >= 6) return;  // Sprawdzenie zakresu
-    barValues[index] = qBound(0.0f, value, 1.0f);  // Ograniczenie wartosci do [0,1]
-    update();  // Przerysuj widget
+
+    QRegion dirty;
+    applyBar(index, qBound(0.0f, value, 1.0f), servoAngles[index], dirty);  // Ograniczenie wartosci do [0,1]
+    if (!dirty.isEmpty()) update(dirty);  // Przerysuj zmieniony fragment
 }
 
 void HexagonBars::updateServoAngles(const QVector<int>& angles) {
     if (angles.size() != 6)
         return;
 
-    servoAngles = angles;  // Zapisz kąty
-
+    QRegion dirty;
     for (int i = 0; i < 6; ++i) {
         // Przelicz kat [-90, 90] na wartosc [0, 1]
-        float normalized = qBound(0.0f, (angles[i] + 90.0f) / 180.0f, 1.0f);
-        setBarValue(i, normalized);
+        const float value = qBound(0.0f, (angles[i] + 90.0f) / 180.0f, 1.0f);
+        applyBar(i, value, angles[i], dirty);
+    }
+
+    // Jedno przerysowanie tylko dla zmienionych paskow
+    if (!dirty.isEmpty()) update(dirty);
+}
+
+// Zapis nowej wartosci paska i zebranie obszaru do przerysowania
+void HexagonBars::applyBar(int index, float value, int angle, QRegion &dirty) {
+    if (barValues[index] == value && servoAngles[index] == angle)
+        return;  // Bez zmian - nic do rysowania
+
+    dirty += barArea(index);  // Obszar przed zmiana
+
+    barValues[index] = value;
+    if (servoAngles[index] != angle) {
+        servoAngles[index] = angle;  // Zapisz kąt
+        updateLabel(index);
     }
+
+    dirty += barArea(index);  // Obszar po zmianie
 }
 
 // Pobranie wartosci paska
@@ -34,7 +59,7 @@ float HexagonBars::getBarValue(int index) const {
     return (index >= 0 && index < 6) ? barValues[index] : 0.0f;
 }
 
-// Oblicz wspolrzedne 6 wierzcholkow szesciokata
+// Oblicz wspolrzedne 6 wierzcholkow szesciokata i geometrie paskow
 void HexagonBars::calculateHexagon() {
     hexagonPoints.clear();
 
@@ -49,6 +74,43 @@ void HexagonBars::calculateHexagon() {
         hexagonPoints.append(QPointF(x, y));  // Dodaj wierzcholek
         angleDeg += 60;  // Kolejny kat (co 60 stopni)
     }
+
+    barLength = size * 0.3f;  // Dlugosc paskow = 30% rozmiaru
+    QPointF center = QPointF(width() / 2, height() / 2);  // Srodek widgetu
+
+    for (int i = 0; i < 6; ++i) {
+        BarGeometry &bar = bars[i];
+        bar.origin = hexagonPoints[i];
+
+        // Kierunek od punktu zewnetrznego do srodka
+        QPointF direction = center - bar.origin;
+        const qreal length = std::hypot(direction.x(), direction.y());
+        bar.direction = length > 0 ? direction / length : QPointF(0, 1);  // Normalizacja
+
+        // Przesuniecie do wierzcholka i obrot do kierunku paska
+        bar.transform.reset();
+        bar.transform.translate(bar.origin.x(), bar.origin.y());
+        bar.transform.rotate(qRadiansToDegrees(std::atan2(bar.direction.y(), bar.direction.x())));
+    }
+}
+
+// Zmiana rozmiaru - przeliczenie geometrii i warstwy statycznej
+void HexagonBars::resizeEvent(QResizeEvent *event) {
+    QWidget::resizeEvent(event);
+    calculateHexagon();
+    rebuildStaticLayer();
+}
+
+// Kontur szesciokata rysowany raz do bufora
+void HexagonBars::rebuildStaticLayer() {
+    const qreal dpr = devicePixelRatioF();
+    staticLayer = QPixmap(size() * dpr);
+    staticLayer.setDevicePixelRatio(dpr);
+    staticLayer.fill(Qt::transparent);
+
+    QPainter painter(&staticLayer);
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    drawHexagon(painter);
 }
 
 // Minimalny rozmiar widgetu
@@ -62,12 +124,11 @@ QSize HexagonBars::sizeHint() const {
 }
 
 // Glowna funkcja rysujaca widget
-void HexagonBars::paintEvent(QPaintEvent *) {
+void HexagonBars::paintEvent(QPaintEvent *event) {
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing, true);
-    calculateHexagon();      // Odswiez wspolrzedne szesciokata
-    drawBars(painter);       // Rysuj paski
-    drawHexagon(painter);    // Rysuj kontur szesciokata
+    drawBars(painter, event->region());     // Rysuj paski (tylko w obszarze zmian)
+    painter.drawPixmap(0, 0, staticLayer);  // Kontur szesciokata z bufora
 }
 
 // Rysuj kontur szesciokata
@@ -84,97 +145,110 @@ void HexagonBars::drawHexagon(QPainter &painter) {
 }
 
 // Rysuj wskazniki wysokosci (np. cienie lub efekty podniesienia)
-void HexagonBars::drawHeightIndicators(QPainter &painter, const QVector<float>& heights) {
+void HexagonBars::drawHeightIndicators(QPainter &painter) {
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 40));  // Pólprzezroczysty cien
+
     for (int i = 0; i < 6; ++i) {
         QPointF outerPoint = hexagonPoints[i];
-        float height = heights[i];
+        float height = barValues[i] * 10;  // "Wysokosc" efektu 3D
 
         if (height > 0) {
-            painter.setPen(Qt::NoPen);
-            painter.setBrush(QColor(0, 0, 0, 40));  // Pólprzezroczysty cien
             QRectF shadowRect(outerPoint.x() - 5, outerPoint.y() - 5, 10, height);
             painter.drawEllipse(shadowRect);  // Cien elipsy jako efekt podniesienia
         }
     }
 }
 
-// Rysuj paski wychodzace ze szesciokata
-void HexagonBars::drawBars(QPainter &painter) {
-    float barLength = qMin(width(), height()) * 0.3f;  // Dlugosc paskow = 30% rozmiaru
-    float barWidth = 10;  // Szerokosc paska
-    QVector<QPointF> barTips;  // Koncowe punkty paskow
+// Koniec paska dla aktualnej wartosci
+QPointF HexagonBars::barTip(int index) const {
+    const BarGeometry &bar = bars[index];
+    return bar.origin + bar.direction * (barLength * barValues[index]);
+}
 
-    QVector<float> barHeights;  // Wysokosci do efektu podniesienia
-    QPointF center = QPointF(width() / 2, height() / 2);  // Srodek widgetu
+// Odswiezenie tekstu kata i jego rozmiaru
+void HexagonBars::updateLabel(int index) {
+    // Tekst kąta z ° (stopni)
+    labelTexts[index] = QString::number(servoAngles[index]) + QChar(176);
+    labelSizes[index] = labelMetrics.boundingRect(labelTexts[index]).size();
+}
 
-    QFont angleFont = painter.font();
-    angleFont.setPointSize(10);
-    painter.setFont(angleFont);
+// Obszar widgetu zalezny od stanu jednego paska
+QRect HexagonBars::barArea(int index) const {
+    const BarGeometry &bar = bars[index];
+    const float value = barValues[index];
+    const float barWidth = 10;  // Szerokosc paska
 
-    for (int i = 0; i < 6; ++i) {
-        float value = barValues[i];
-        QPointF outerPoint = hexagonPoints[i];
+    // Prostokat paska po obrocie
+    QRectF area = bar.transform.mapRect(QRectF(0, -barWidth / 2, barLength * value, barWidth));
 
-        // Kierunek od punktu zewnetrznego do srodka
-        QPointF direction = center - outerPoint;
-        direction = direction / std::hypot(direction.x(), direction.y());  // Normalizacja
+    // Etykieta kata za koncem paska
+    const QPointF tip = barTip(index);
+    QRectF textRect(QPointF(0, 0), labelSizes[index]);
+    textRect.moveCenter(tip + bar.direction * 15);
+    area |= textRect;
 
-        // Oblicz koniec paska na podstawie wartosci
-        QPointF tip = outerPoint + direction * (barLength * value);
-        barTips.append(tip);
+    // Cien przy wierzcholku
+    area |= QRectF(bar.origin.x() - 5, bar.origin.y() - 5, 10, value * 10);
 
-        float height = value * 10;  // "Wysokosc" efektu 3D
-        barHeights.append(height);
+    // Krawedzie szesciokata laczacego konce paskow
+    const QPointF prev = barTip((index + 5) % 6);
+    const QPointF next = barTip((index + 1) % 6);
+    area |= QRectF(tip, prev).normalized();
+    area |= QRectF(tip, next).normalized();
 
-        // Rysowanie paska
-        painter.save();
-        painter.translate(outerPoint);  // Przesun punkt odniesienia
+    // Margines na grubosc linii i wygladzanie
+    return area.toAlignedRect().adjusted(-3, -3, 3, 3);
+}
 
-        float angleRad = std::atan2(direction.y(), direction.x());
-        float angleDeg = qRadiansToDegrees(angleRad);
-        painter.rotate(angleDeg);  // Obrót do kierunku paska
+// Rysuj paski wychodzace ze szesciokata
+void HexagonBars::drawBars(QPainter &painter, const QRegion &dirty) {
+    float barWidth = 10;  // Szerokosc paska
+    QPointF barTips[6];   // Koncowe punkty paskow
+
+    QPen borderPen(Qt::white);  // Obramowanie biale
+    borderPen.setWidth(2);
+
+    painter.setFont(labelFont);
+
+    for (int i = 0; i < 6; ++i) {
+        barTips[i] = barTip(i);
 
-        QColor barColor = getBarColor(value);  // Kolor w zaleznosci od wartosci
-        painter.setBrush(barColor);
+        // Pasek poza obszarem przerysowania - pomijamy
+        if (!dirty.intersects(barArea(i)))
+            continue;
 
-        QPen borderPen(Qt::white);  // Obramowanie biale
-        borderPen.setWidth(2);
+        float value = barValues[i];
+
+        // Rysowanie paska w ukladzie wspolrzednych paska
+        painter.setTransform(bars[i].transform);
+        painter.setBrush(getBarColor(value));  // Kolor w zaleznosci od wartosci
         painter.setPen(borderPen);
 
         QRectF barRect(0, -barWidth / 2, barLength * value, barWidth);
         painter.drawRect(barRect);  // Rysuj prostokat paska
 
-        painter.restore();  // Przywroc poprzedni stan painter'a
-
-        // Pozycja końca paska
-        QPointF labelBase = outerPoint + direction * (barLength * value);
+        painter.resetTransform();  // Przywroc uklad widgetu
 
         // Przesunięcie tekstu w kierunku wzrostu paska (czyli zgodnie z direction)
         float textOffset = 15;  // Dystans od końca paska
-        QPointF labelPos = labelBase + direction * textOffset;
-
-        // Tekst kąta z ° (stopni)
-        QString angleText = (i < servoAngles.size()) ? QString::number(servoAngles[i]) + QChar(176) : "?";
+        QPointF labelPos = barTips[i] + bars[i].direction * textOffset;
 
         // Wyśrodkowane rysowanie tekstu
-        QFont font("Arial", 10, QFont::Bold);
-        painter.setFont(font);
         painter.setPen(Qt::white);
-
-        QFontMetrics fm(font);
-        QRectF textRect = fm.boundingRect(angleText);
+        QRectF textRect(QPointF(0, 0), labelSizes[i]);
         textRect.moveCenter(labelPos);  // Wycentrowanie prostokąta na labelPos
 
-        painter.drawText(textRect, Qt::AlignCenter, angleText);
+        painter.drawText(textRect, Qt::AlignCenter, labelTexts[i]);
     }
 
     // Rysuj szesciokat laczacy konce paskow
     painter.setPen(QPen(Qt::magenta, 2));
     painter.setBrush(Qt::NoBrush);
-    painter.drawPolygon(QPolygonF(barTips));
+    painter.drawPolygon(barTips, 6);
 
     // Rysuj efekty wysokosci (np. cienie)
-    drawHeightIndicators(painter, barHeights);
+    drawHeightIndicators(painter);
 }
 
 // Funkcja zwraca kolor paska w zaleznosci od wartosci
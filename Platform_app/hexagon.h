@@ -16,6 +16,10 @@
 #include <QWidget>
 #include <QVector>
 #include <QPointF>
+#include <QPixmap>
+#include <QFont>
+#include <QFontMetricsF>
+#include <QTransform>
 
 /**
  * @class HexagonBars
@@ -30,6 +34,9 @@
  *
  * The widget maintains geometric proportions during resizing and
  * provides smooth visual transitions during value changes.
+ *
+ * Geometry, fonts and the static hexagon outline are prepared on resize;
+ * a value change only repaints the area of the bars and labels it affects.
  */
 class HexagonBars : public QWidget {
     Q_OBJECT
@@ -81,18 +88,48 @@ protected:
      */
     void paintEvent(QPaintEvent *event) override;
 
+    /**
+     * @brief Recomputes cached geometry and the static layer
+     * @param event Qt resize event object
+     */
+    void resizeEvent(QResizeEvent *event) override;
+
 private:
+    /**
+     * @struct BarGeometry
+     * @brief Size-dependent placement of one bar, computed on resize
+     */
+    struct BarGeometry {
+        QPointF origin;        ///< Hexagon vertex the bar starts from
+        QPointF direction;     ///< Unit vector towards the center
+        QTransform transform;  ///< Maps bar-local coordinates (x along the bar) to the widget
+    };
+
     QVector<float> barValues;      ///< Stores normalized values for all six bars
     QVector<QPointF> hexagonPoints;///< Pre-calculated hexagon vertices (in widget coordinates)
+    BarGeometry bars[6];           ///< Pre-calculated bar placement
+    qreal barLength = 0;           ///< Length of a bar at value 1.0
+    QPixmap staticLayer;           ///< Hexagon outline rendered once per size
+
+    QFont labelFont;               ///< Font of the angle labels
+    QFontMetricsF labelMetrics;    ///< Metrics of labelFont
+    QString labelTexts[6];         ///< Current angle label texts
+    QSizeF labelSizes[6];          ///< Bounding sizes of labelTexts
 
     /**
      * @brief Recalculates hexagon geometry
      *
      * @details Computes vertex positions based on current widget dimensions,
-     *          maintaining proper aspect ratio and centering.
+     *          maintaining proper aspect ratio and centering, together with
+     *          the per-bar directions and transforms.
      */
     void calculateHexagon();
 
+    /**
+     * @brief Renders the static hexagon outline into staticLayer
+     */
+    void rebuildStaticLayer();
+
     /**
      * @brief Renders the hexagonal outline
      * @param painter Reference to active QPainter
@@ -107,13 +144,45 @@ private:
     /**
      * @brief Renders the value bars
      * @param painter Reference to active QPainter
+     * @param dirty   Area being repainted; bars outside it are skipped
      *
      * @details For each bar:
      *          - Calculates length based on current value
      *          - Applies color gradient
      *          - Adds value text labels (optional)
      */
-    void drawBars(QPainter &painter);
+    void drawBars(QPainter &painter, const QRegion &dirty);
+
+    /**
+     * @brief Refreshes the cached label text and size of one bar
+     * @param index Bar index (0-5)
+     */
+    void updateLabel(int index);
+
+    /**
+     * @brief End point of a bar for its current value
+     * @param index Bar index (0-5)
+     */
+    QPointF barTip(int index) const;
+
+    /**
+     * @brief Widget area affected by the current state of one bar
+     * @param index Bar index (0-5)
+     * @return Bar, label, shadow and adjacent tip polygon edges
+     *
+     * @details Called before and after a value change; the union of both
+     *          is the only area that has to be repainted.
+     */
+    QRect barArea(int index) const;
+
+    /**
+     * @brief Stores a new bar value and schedules a partial repaint
+     * @param index Bar index (0-5)
+     * @param value Normalized value (0.0 to 1.0)
+     * @param angle Servo angle shown in the label
+     * @param dirty Accumulates the area to repaint
+     */
+    void applyBar(int index, float value, int angle, QRegion &dirty);
 
     /**
      * @brief Provides recommended minimum widget size
@@ -130,14 +199,14 @@ private:
     /**
      * @brief Renders additional height indicators
      * @param painter Reference to active QPainter
-     * @param heights Height values for each bar
      *
      * @details Used for visualizing secondary data dimensions:
+     *          - Heights are derived from the bar values
      *          - Draws as concentric hexagons
      *          - Uses semi-transparent fill
      *          - Supports platform height visualization
      */
-    void drawHeightIndicators(QPainter &painter, const QVector<float>& heights);
+    void drawHeightIndicators(QPainter &painter);
 
     /**
      * @brief Generates value-dependent bar color
@@ -20,6 +20,10 @@
 #include <QLabel>
 #include <QGridLayout>
 
+#include "ValueReadout.h"
+
+class LatencyProbe;
+
 /**
  * @class IMUDisplay
  * @brief Widget for visualizing IMU sensor data in real-time
@@ -32,6 +36,9 @@
  * - Separate sections for accelerometer and gyroscope
  * - Clear axis labeling
  * - Consistent numerical formatting
+ *
+ * All six values are drawn by one ValueReadout, so an update costs a
+ * repaint of the changed digits only.
  */
 class IMUDisplay : public QWidget {
     Q_OBJECT
@@ -39,7 +46,7 @@ class IMUDisplay : public QWidget {
 public:
     /**
      * @brief Constructs an IMU display widget
-     * @param id IMU identifier (used for display differentiation)
+     * @param id IMU identifier shown in the header
      * @param parent Parent widget (default: nullptr)
      *
      * @details Initializes all UI elements including:
@@ -47,7 +54,7 @@ public:
      *          - Value display areas
      *          - Layout organization
      */
-    explicit IMUDisplay(bool id, QWidget *parent = nullptr);
+    explicit IMUDisplay(int id, QWidget *parent = nullptr);
 
     /**
      * @brief Updates all displayed sensor values
@@ -60,13 +67,19 @@ public:
      *
      * @details Accepts new sensor readings and:
      *          - Formats values to 2 decimal places
-     *          - Updates all display labels
+     *          - Repaints only values whose digits changed
      *          - Maintains consistent units display
      *
      * @note All values should be in consistent units (typically SI units)
      */
     void updateValues(float ax, float ay, float az, float gx, float gy, float gz);
 
+    /**
+     * @brief Reports readout repaints to a latency probe
+     * @param probe Probe notified when the values are painted
+     */
+    void setLatencyProbe(LatencyProbe *probe);
+
     /**
      * @brief Updates all user-visible strings in the UI to reflect the current language.
      *
@@ -78,48 +91,19 @@ public:
 
 private:
     /**
-     * @brief Creates a standardized value display label
-     * @return Configured QLabel pointer
-     *
-     * @details Creates labels with consistent:
-     *          - Font styling
-     *          - Alignment
-     *          - Minimum width
-     *          - Numeric formatting
+     * @enum Axis
+     * @brief Row of each value in the readout
      */
-    QLabel *createValueLabel();
+    enum Axis { AccelX, AccelY, AccelZ, GyroX, GyroY, GyroZ, AxisCount };
 
     /**
-     * @brief Configures display elements for one sensor axis
-     * @param layout Target grid layout for placement
-     * @param name Axis name identifier ("X", "Y", or "Z")
-     * @param row Grid layout row position
+     * @brief Sets captions and units of all readout rows
      *
-     * @details Creates and positions:
-     *          - Axis name label
-     *          - Value display label
-     *          - Proper spacing elements
+     * @details Used at construction and on language change.
      */
-    void setupAxisDisplay(QGridLayout *layout, const QString &name, int row);
-
-    /**
-     * @struct AxisDisplay
-     * @brief Container for axis display elements
-     */
-    struct AxisDisplay {
-        QLabel *nameLabel;  ///< Label showing axis identifier (e.g., "Accel X")
-        QLabel *valueLabel; ///< Label showing current value (e.g., "1.23 m/s²")
-    };
-
-    // Accelerometer displays
-    AxisDisplay m_accelX; ///< X-axis acceleration display
-    AxisDisplay m_accelY; ///< Y-axis acceleration display
-    AxisDisplay m_accelZ; ///< Z-axis acceleration display
+    void setupAxisNames();
 
-    // Gyroscope displays
-    AxisDisplay m_gyroX;  ///< X-axis angular velocity display
-    AxisDisplay m_gyroY;  ///< Y-axis angular velocity display
-    AxisDisplay m_gyroZ;  ///< Z-axis angular velocity display
+    ValueReadout *m_readout; ///< Painted accelerometer and gyroscope values
 
     /**
  * @brief Main header label displaying the IMU data title.
@@ -136,7 +120,7 @@ private:
     QString Title;
 
     /**
- * @brief Identifier suffix string ("1" or "2") for the IMU display.
+ * @brief Identifier suffix string (IMU id) for the IMU display.
  *
  * Distinguishes between multiple IMU devices in the UI.
  */
@@ -0,0 +1,431 @@
+/**
+ * @file    platform_ingest.cpp
+ * @brief   Headless capture of the platform serial stream
+ *
+ * @details Records the platform data on machines without a display (lab
+ *          PCs, CI) without starting Qt Widgets, Qt3D or Charts:
+ *          - Opens the serial port in raw 8N1 mode at the given baud rate
+ *          - Decodes the bytes with the same StreamDecoder path as
+ *            SerialReader::readSerialData(), with automatic ASCII/binary
+ *            detection and arrival timestamps
+ *          - Writes the samples as a session file (readable by the GUI
+ *            replay and platform_bench --session) or as CSV lines
+ *          - Prints throughput and error statistics to stderr periodically
+ *          - Reopens the port after a disconnect, so it can run for days
+ *
+ *          The tool links only platform_core; memory use is bounded by the
+ *          decoder buffer and one output chunk.
+ *
+ * Usage: platform_ingest --port /dev/ttyUSB0 [options]; SIGINT or SIGTERM
+ *        writes the pending samples and exits.
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "PlatformSample.h"
+#include "SessionFormat.h"
+#include "SessionWriter.h"
+#include "StreamDecoder.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr int64_t kSecondNs = 1000000000;
+constexpr int64_t kFlushIntervalNs = kSecondNs;     // Maksymalny czas oczekiwania probek na zapis
+constexpr int64_t kReconnectIntervalNs = kSecondNs; // Odstep prob ponownego otwarcia portu
+constexpr int kPollMs = 100;                        // Limit oczekiwania na dane
+
+volatile std::sig_atomic_t g_stop = 0;
+
+// Konfiguracja
+struct Options {
+    std::string port;               // Port szeregowy
+    long baud = 115200;             // Predkosc transmisji
+    std::string output = "-";       // Plik wyjsciowy ("-" = stdout)
+    std::string format;             // session | csv (domyslnie wg wyjscia)
+    double statsInterval = 10.0;    // Okres statystyk w sekundach (0 = bez statystyk)
+    double duration = 0.0;          // Czas dzialania (0 = bez limitu)
+    std::size_t chunkRecords = 4096;// Probki w jednym fragmencie pliku sesji
+    bool verbose = false;           // Wypisywanie odrzuconych ramek
+};
+
+void usage()
+{
+    std::fprintf(stderr,
+                 "Usage: platform_ingest --port PATH [options]\n"
+                 "  --port PATH        Serial port (e.g. /dev/ttyUSB0)\n"
+                 "  --baud N           Baud rate (default 115200)\n"
+                 "  --output FILE      Output file, - for stdout (default -)\n"
+                 "  --format NAME      session | csv (default: session for files, csv for stdout)\n"
+                 "  --stats S          Statistics period in seconds, 0 disables (default 10)\n"
+                 "  --duration S       Stop after S seconds\n"
+                 "  --chunk N          Samples per session chunk (default 4096)\n"
+                 "  --verbose          Print rejected frames\n");
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--port" && hasValue) options.port = argv[++i];
+        else if (arg == "--baud" && hasValue) options.baud = std::atol(argv[++i]);
+        else if ((arg == "--output" || arg == "-o") && hasValue) options.output = argv[++i];
+        else if (arg == "--format" && hasValue) options.format = argv[++i];
+        else if (arg == "--stats" && hasValue) options.statsInterval = std::atof(argv[++i]);
+        else if (arg == "--duration" && hasValue) options.duration = std::atof(argv[++i]);
+        else if (arg == "--chunk" && hasValue) options.chunkRecords = static_cast<std::size_t>(std::atol(argv[++i]));
+        else if (arg == "--verbose") options.verbose = true;
+        else return false;
+    }
+
+    if (options.format.empty())
+        options.format = (options.output == "-") ? "csv" : "session";
+
+    return !options.port.empty() && options.baud > 0 && options.statsInterval >= 0
+           && options.chunkRecords > 0 && (options.format == "session" || options.format == "csv");
+}
+
+// Stala termios dla predkosci transmisji
+bool baudConstant(long baud, speed_t &speed)
+{
+    static const struct { long baud; speed_t speed; } kRates[] = {
+        { 1200, B1200 }, { 2400, B2400 }, { 4800, B4800 }, { 9600, B9600 },
+        { 19200, B19200 }, { 38400, B38400 }, { 57600, B57600 }, { 115200, B115200 },
+        { 230400, B230400 }, { 460800, B460800 }, { 500000, B500000 }, { 576000, B576000 },
+        { 921600, B921600 }, { 1000000, B1000000 }, { 1152000, B1152000 }, { 1500000, B1500000 },
+        { 2000000, B2000000 }, { 2500000, B2500000 }, { 3000000, B3000000 }, { 3500000, B3500000 },
+        { 4000000, B4000000 },
+    };
+    for (const auto &rate : kRates) {
+        if (rate.baud == baud) {
+            speed = rate.speed;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Otwarcie portu w trybie surowym 8N1 bez sterowania przeplywem (jak QSerialPort)
+int openPort(const Options &options, bool reportErrors = true)
+{
+    speed_t speed;
+    if (!baudConstant(options.baud, speed)) {
+        std::fprintf(stderr, "Unsupported baud rate: %ld\n", options.baud);
+        return -1;
+    }
+
+    const int fd = open(options.port.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) {
+        if (reportErrors)
+            std::fprintf(stderr, "Cannot open %s: %s\n", options.port.c_str(), std::strerror(errno));
+        return -1;
+    }
+
+    termios tio;
+    if (tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cflag &= ~(CSTOPB | CRTSCTS);
+        tio.c_iflag &= ~(IXON | IXOFF | IXANY);
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        if (tcsetattr(fd, TCSANOW, &tio) != 0)
+            std::fprintf(stderr, "Cannot configure %s: %s\n", options.port.c_str(), std::strerror(errno));
+    }
+    tcflush(fd, TCIFLUSH);
+    return fd;
+}
+
+const char *protocolName(StreamDecoder::Protocol protocol)
+{
+    switch (protocol) {
+    case StreamDecoder::Protocol::Ascii:  return "ASCII";
+    case StreamDecoder::Protocol::Binary: return "BIN";
+    default:                              return "-";
+    }
+}
+
+// Wyjscie probek: plik sesji lub CSV
+class SampleSink
+{
+public:
+    explicit SampleSink(const Options &options)
+        : m_csv(options.format == "csv"), m_path(options.output), m_capacity(options.chunkRecords)
+    {
+        if (!m_csv) m_records.reserve(m_capacity);
+    }
+
+    ~SampleSink()
+    {
+        if (m_file && m_file != stdout) std::fclose(m_file);
+    }
+
+    bool open()
+    {
+        // Plik sesji - naglowek i fragmenty jak w SessionRecorder
+        if (!m_csv) {
+            const int64_t startNs = monotonicNowNs();
+            const bool opened = (m_path == "-") ? m_session.open(stdout, startNs)
+                                                : m_session.open(m_path.c_str(), startNs);
+            if (!opened)
+                std::fprintf(stderr, "Cannot create %s: %s\n", m_path.c_str(), m_session.errorString());
+            return opened;
+        }
+
+        m_file = (m_path == "-") ? stdout : std::fopen(m_path.c_str(), "wb");
+        if (!m_file) {
+            std::fprintf(stderr, "Cannot create %s: %s\n", m_path.c_str(), std::strerror(errno));
+            return false;
+        }
+        // Duzy bufor - zapis do systemu paczkami, nie po kazdej linii
+        std::setvbuf(m_file, nullptr, _IOFBF, 1 << 16);
+        return std::fputs("timestamp_ns,type,imu_id,v1,v2,v3,v4,v5,v6\n", m_file) >= 0;
+    }
+
+    bool write(const PlatformSample &sample)
+    {
+        ++m_written;
+        if (m_pendingNs == 0) m_pendingNs = sample.timestampNs;
+        if (m_csv) {
+            const int16_t *v = sample.values;
+            const int written = (sample.type == PlatformSample::Type::Imu)
+                ? std::fprintf(m_file, "%lld,IMU,%d,%d,%d,%d,%d,%d,%d\n",
+                               static_cast<long long>(sample.timestampNs), sample.imuId,
+                               v[0], v[1], v[2], v[3], v[4], v[5])
+                : std::fprintf(m_file, "%lld,S,,%d,%d,%d,%d,%d,%d\n",
+                               static_cast<long long>(sample.timestampNs),
+                               v[0], v[1], v[2], v[3], v[4], v[5]);
+            if (written < 0) m_errno = errno;
+            return written > 0;
+        }
+
+        m_records.push_back(toSessionRecord(sample));
+        if (m_records.size() == m_capacity
+            || sample.timestampNs - m_records.front().timestampNs >= kFlushIntervalNs)
+            return flush();
+        return true;
+    }
+
+    // Zapis zaleglych probek (fragment sesji lub bufor CSV)
+    bool flush()
+    {
+        m_pendingNs = 0;
+        if (m_csv) {
+            if (std::fflush(m_file) == 0) return true;
+            m_errno = errno;
+            return false;
+        }
+
+        const bool ok = m_session.writeChunk(m_records.data(), m_records.size());
+        m_records.clear();
+        return ok;
+    }
+
+    // Probki czekajace na zapis dluzej niz kFlushIntervalNs
+    bool stale(int64_t nowNs) const
+    {
+        return m_pendingNs != 0 && nowNs - m_pendingNs >= kFlushIntervalNs;
+    }
+
+    uint64_t written() const { return m_written; }
+
+    // Opis bledu zapisu zapamietany przy jego wystapieniu
+    const char *errorString() const
+    {
+        return m_csv ? std::strerror(m_errno) : m_session.errorString();
+    }
+
+private:
+    bool m_csv;                             // Format CSV zamiast pliku sesji
+    std::string m_path;                     // Sciezka wyjscia
+    std::size_t m_capacity;                 // Rozmiar fragmentu
+    std::FILE *m_file = nullptr;            // Plik CSV
+    SessionWriter m_session;                // Plik sesji
+    std::vector<SessionRecord> m_records;   // Biezacy fragment sesji
+    uint64_t m_written = 0;                 // Probki przekazane do zapisu
+    int64_t m_pendingNs = 0;                // Czas najstarszej niezapisanej probki (0 = brak)
+    int m_errno = 0;                        // errno ostatniego bledu zapisu CSV
+};
+
+// Liczniki calego przebiegu (dekoder zeruje swoje przy ponownym otwarciu portu)
+struct Totals {
+    uint64_t bytes = 0;         // Odebrane bajty
+    uint64_t frames = 0;        // Poprawne ramki
+    uint64_t errors = 0;        // Odrzucone ramki
+    uint64_t crcErrors = 0;     // W tym bledy sumy kontrolnej
+    uint64_t lostFrames = 0;    // Ramki binarne brakujace wg numerow sekwencji
+    uint64_t overflows = 0;     // Zbyt dlugie ramki odrzucone przez ramkowanie
+    uint64_t reconnects = 0;    // Ponowne otwarcia portu
+};
+
+// Odrzucona ramka na stderr (tekst wprost, ramka binarna szesnastkowo)
+void printRejected(const StreamDecoder::Result &result)
+{
+    std::fprintf(stderr, "Rejected frame (status %d): ", static_cast<int>(result.status));
+    if (result.protocol == StreamDecoder::Protocol::Binary) {
+        for (char c : result.frame)
+            std::fprintf(stderr, "%02x", static_cast<unsigned char>(c));
+    } else {
+        std::fwrite(result.frame.data(), 1, result.frame.size(), stderr);
+    }
+    std::fputc('\n', stderr);
+}
+
+// Dekodowanie odebranych bajtow - ta sama sciezka co SerialReader::readSerialData()
+bool drain(StreamDecoder &decoder, int64_t arrivalNs, SampleSink &sink, Totals &totals, bool verbose)
+{
+    PlatformSample sample;
+    for (StreamDecoder::Result result = decoder.next(sample);
+         result.status != StreamDecoder::Status::NeedMoreData;
+         result = decoder.next(sample)) {
+        if (result.status == StreamDecoder::Status::Ok) {
+            sample.timestampNs = arrivalNs;
+            ++totals.frames;
+            if (!sink.write(sample)) return false;
+        } else {
+            ++totals.errors;
+            if (result.status == StreamDecoder::Status::CrcMismatch) ++totals.crcErrors;
+            if (verbose) printRejected(result);
+        }
+    }
+    return true;
+}
+
+// Przeniesienie licznikow dekodera do sumy przed jego wyzerowaniem
+void carryCounters(const StreamDecoder &decoder, Totals &totals)
+{
+    totals.lostFrames += decoder.counters().lostFrames;
+    totals.overflows += decoder.overflowCount();
+}
+
+void onSignal(int)
+{
+    g_stop = 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    SampleSink sink(options);
+    if (!sink.open()) return 1;
+
+    // Brak portu przy starcie to blad konfiguracji; pozniejsze rozlaczenia sa ponawiane
+    int fd = openPort(options);
+    if (fd < 0) return 1;
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+    std::signal(SIGPIPE, SIG_IGN);  // Zamkniety odbiorca stdout - blad zapisu zamiast przerwania
+
+    StreamDecoder decoder;
+    Totals totals;
+    Totals last;
+    const int64_t startNs = monotonicNowNs();
+    const int64_t statsNs = static_cast<int64_t>(options.statsInterval * kSecondNs);
+    const int64_t durationNs = static_cast<int64_t>(options.duration * kSecondNs);
+    int64_t lastStatsNs = startNs;
+    int64_t reopenNs = 0;
+    bool reopenFailed = false;
+    bool ok = true;
+
+    while (!g_stop && ok) {
+        int64_t nowNs = monotonicNowNs();
+        if (durationNs > 0 && nowNs - startNs >= durationNs) break;
+
+        if (fd < 0) {
+            // Ponowne otwarcie portu co sekunde (blad zglaszany raz na rozlaczenie)
+            if (nowNs >= reopenNs) {
+                fd = openPort(options, !reopenFailed);
+                reopenFailed = (fd < 0);
+                reopenNs = nowNs + kReconnectIntervalNs;
+                if (fd >= 0) {
+                    ++totals.reconnects;
+                    std::fprintf(stderr, "Reconnected to %s\n", options.port.c_str());
+                }
+            }
+            if (fd < 0) poll(nullptr, 0, kPollMs);
+        } else {
+            pollfd p = { fd, POLLIN, 0 };
+            if (poll(&p, 1, kPollMs) > 0) {
+                // Odczyt bezposrednio do bufora dekodera, bez posrednich kopii
+                const int64_t arrivalNs = monotonicNowNs();
+                // Wskaznik i rozmiar pobierane razem, przed odczytem (zawsze co najmniej jeden bajt)
+                const LineFramer::WriteSpan span = decoder.writeSpan();
+                const ssize_t received = read(fd, span.data, span.size);
+                if (received > 0) {
+                    decoder.commit(static_cast<std::size_t>(received));
+                    totals.bytes += static_cast<uint64_t>(received);
+                    ok = drain(decoder, arrivalNs, sink, totals, options.verbose);
+                } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                    std::fprintf(stderr, "Connection to %s lost: %s\n", options.port.c_str(),
+                                 received == 0 ? "end of stream" : std::strerror(errno));
+                    close(fd);
+                    fd = -1;
+                    carryCounters(decoder, totals);
+                    decoder.reset();
+                    reopenNs = monotonicNowNs() + kReconnectIntervalNs;
+                }
+            }
+        }
+
+        // Probki nie czekaja na zapis dluzej niz sekunde, takze przy braku danych
+        nowNs = monotonicNowNs();
+        if (ok && sink.stale(nowNs)) ok = sink.flush();
+
+        // Statystyki okresowe
+        if (statsNs > 0 && nowNs - lastStatsNs >= statsNs) {
+            const double dt = (nowNs - lastStatsNs) * 1e-9;
+            std::fprintf(stderr,
+                         "t=%.0fs frames/s=%.0f kB/s=%.1f errors=%llu crc=%llu lost=%llu overflow=%llu"
+                         " protocol=%s written=%llu reconnects=%llu\n",
+                         (nowNs - startNs) * 1e-9,
+                         (totals.frames - last.frames) / dt,
+                         (totals.bytes - last.bytes) / dt / 1000.0,
+                         static_cast<unsigned long long>(totals.errors),
+                         static_cast<unsigned long long>(totals.crcErrors),
+                         static_cast<unsigned long long>(totals.lostFrames + decoder.counters().lostFrames),
+                         static_cast<unsigned long long>(totals.overflows + decoder.overflowCount()),
+                         protocolName(decoder.protocol()),
+                         static_cast<unsigned long long>(sink.written()),
+                         static_cast<unsigned long long>(totals.reconnects));
+            last = totals;
+            lastStatsNs = nowNs;
+        }
+    }
+
+    if (ok) ok = sink.flush();
+    if (!ok) std::fprintf(stderr, "Cannot write %s: %s\n", options.output.c_str(), sink.errorString());
+    if (fd >= 0) {
+        carryCounters(decoder, totals);
+        close(fd);
+    }
+
+    std::fprintf(stderr, "frames=%llu errors=%llu lost=%llu bytes=%llu written=%llu\n",
+                 static_cast<unsigned long long>(totals.frames),
+                 static_cast<unsigned long long>(totals.errors),
+                 static_cast<unsigned long long>(totals.lostFrames),
+                 static_cast<unsigned long long>(totals.bytes),
+                 static_cast<unsigned long long>(sink.written()));
+    return ok ? 0 : 1;
+}
@@ -2,6 +2,9 @@
 #include <QApplication>
 #include <QTranslator>
 #include <QDir>
+#include <QCommandLineParser>
+#include <QDebug>
+#include <QStringList>
 
 int main(int argc, char *argv[])
 {
@@ -14,7 +17,50 @@ int main(int argc, char *argv[])
     }
 
 
+    // Opcje wiersza polecen
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption fpsOption("fps", "Widget refresh rate in Hz (0 = screen refresh rate).", "hz", "0");
+    parser.addOption(fpsOption);
+    QCommandLineOption replayOption("replay", "Replay a recorded session file.", "file");
+    parser.addOption(replayOption);
+    QCommandLineOption speedOption("speed", "Replay speed 1-100, 0 = as fast as possible.", "x", "1");
+    parser.addOption(speedOption);
+    QCommandLineOption exitOption("exit-after-replay", "Quit when the replay has finished (load test).");
+    parser.addOption(exitOption);
+    QCommandLineOption rangeOption("imu-range", "Sensor range of one IMU, e.g. 3:16:2000 for id 3 at +-16 g "
+                                   "and 2000 dps (repeatable; default 2 g, 500 dps).", "id:g:dps");
+    parser.addOption(rangeOption);
+    QCommandLineOption latencyOption("latency-dump", "Write latency percentiles per stage to a file at exit.", "file");
+    parser.addOption(latencyOption);
+    parser.process(app);
+
     MainWindow w;
+    w.setDisplayRate(parser.value(fpsOption).toDouble());
+    w.setLatencyDumpFile(parser.value(latencyOption));
+
+    // Zakresy czujnikow poszczegolnych IMU
+    for (const QString &value : parser.values(rangeOption)) {
+        const QStringList fields = value.split(':');
+        bool idValid = false;
+        const int id = fields.size() == 3 ? fields[0].toInt(&idValid) : -1;
+        AccelRange accel;
+        GyroRange gyro;
+        if (!idValid || !accelRangeFromG(fields[1].toInt(), accel) || !gyroRangeFromDps(fields[2].toInt(), gyro)
+            || !w.setImuRange(id, accel, gyro)) {
+            qCritical().noquote() << "Invalid --imu-range:" << value;
+            return 2;
+        }
+    }
+
+    if (parser.isSet(replayOption)) {
+        // Test obciazeniowy nie moze czekac na okno z bledem
+        const bool exitAfterReplay = parser.isSet(exitOption);
+        if (!w.startReplay(parser.value(replayOption), parser.value(speedOption).toDouble(), exitAfterReplay)
+            && exitAfterReplay) {
+            return 1;
+        }
+    }
     w.show();
     return app.exec();
 }
@@ -1,4 +1,5 @@
 #include "mainwindow.h"
+#include "FrameSchema.h"
 #include <QHBoxLayout>
 #include <QVBoxLayout>
 #include <QFrame>
@@ -12,15 +13,23 @@
 #include <QPushButton>
 #include <QDir>
 #include <QApplication>
+#include <QIntValidator>
+#include <QFileDialog>
+#include <QDateTime>
+#include <QFile>
+#include <algorithm>
+#include <numeric>
 
 
 // Konstruktor glownego okna
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent),
-    serial(new QSerialPort(this)),                  // Inicjalizacja portu szeregowego
-    platformViewer(new PlatformViewer())            // Widget do wizualizacji platformy 3D
+    mergeRetryTimer(new QTimer(this)),              // Ponowne scalanie wstrzymanych probek
+    portStatsTimer(new QTimer(this)),               // Liczniki portow w podpowiedzi statusu
+    replay(new SessionReplay(this)),                // Odtwarzanie nagranych sesji
+    platformViewer(new PlatformViewer()),           // Widget do wizualizacji platformy 3D
+    frameScheduler(new FrameScheduler(this))        // Odswiezanie widgetow z czestotliwoscia ekranu
 {
-
     // Załaduj domyślny język
     translator.load("app_pl.qm", QDir::currentPath() + "/translations");
     qApp->installTranslator(&translator);
@@ -48,11 +57,51 @@ MainWindow::MainWindow(QWidget *parent)
     // Lista portow COM
     portComboBox = new QComboBox();
     portComboBox->setMinimumWidth(150);
+    portComboBox->setEditable(true);  // Mozliwosc wpisania sciezki (np. pty symulatora)
+
+    // Predkosc transmisji (wyzsze wartosci dla protokolu binarnego)
+    baudComboBox = new QComboBox();
+    baudComboBox->setEditable(true);
+    baudComboBox->setValidator(new QIntValidator(1200, 12000000, baudComboBox));
+    for (int baud : {115200, 230400, 460800, 921600, 1000000, 2000000}) {
+        baudComboBox->addItem(QString::number(baud));
+    }
+    baudComboBox->setFixedWidth(90);
 
     // Przycisk polaczenia
     connectButton = new QPushButton(tr("Connect"), this);
     connectButton->setFixedWidth(100);
 
+    // Przycisk nagrywania sesji
+    recordButton = new QPushButton(tr("Record"), this);
+    recordButton->setFixedWidth(110);
+
+    // Odtwarzanie nagranej sesji
+    replayButton = new QPushButton(tr("Replay..."), this);
+    replayButton->setFixedWidth(110);
+    pauseButton = new QPushButton(tr("Pause"), this);
+    pauseButton->setFixedWidth(80);
+    pauseButton->setEnabled(false);
+    speedComboBox = new QComboBox();
+    for (int speed : {1, 2, 5, 10, 20, 50, 100}) {
+        speedComboBox->addItem(QString("%1x").arg(speed), speed);
+    }
+    speedComboBox->addItem(tr("Max"), 0);
+    speedComboBox->setFixedWidth(70);
+    replayLabel = new QLabel();
+
+    // Podglad opoznien
+    latencyButton = new QPushButton(tr("Latency"), this);
+    latencyButton->setFixedWidth(90);
+
+    // Statystyki IMU
+    statisticsButton = new QPushButton(tr("Statistics"), this);
+    statisticsButton->setFixedWidth(90);
+
+    // Widmo drgan
+    spectrumButton = new QPushButton(tr("Spectrum"), this);
+    spectrumButton->setFixedWidth(90);
+
     // Etykieta statusu
     statusLabel = new QLabel(tr("Status: Disconnected"));
     statusLabel->setStyleSheet("QLabel { color: red; font-weight: bold; }");
@@ -61,12 +110,29 @@ MainWindow::MainWindow(QWidget *parent)
     controlLayout->addWidget(languageButton);
     controlLayout->addWidget(refreshButton);
     controlLayout->addWidget(portComboBox);
+    controlLayout->addWidget(baudComboBox);
     controlLayout->addWidget(connectButton);
+    controlLayout->addWidget(recordButton);
     controlLayout->addWidget(statusLabel);
     controlLayout->addStretch();
 
     leftLayout->addWidget(controlPanel, 0);
 
+    // Panel odtwarzania sesji
+    QWidget *replayPanel = new QWidget();
+    QHBoxLayout *replayLayout = new QHBoxLayout(replayPanel);
+    replayLayout->setContentsMargins(9, 0, 9, 0);
+    replayLayout->addWidget(replayButton);
+    replayLayout->addWidget(pauseButton);
+    replayLayout->addWidget(speedComboBox);
+    replayLayout->addWidget(replayLabel);
+    replayLayout->addStretch();
+    replayLayout->addWidget(spectrumButton);
+    replayLayout->addWidget(statisticsButton);
+    replayLayout->addWidget(latencyButton);
+
+    leftLayout->addWidget(replayPanel, 0);
+
     // Ramka z platforma 3D
     QFrame *modelFrame = new QFrame();
     modelFrame->setFrameStyle(QFrame::Box | QFrame::Raised);
@@ -77,6 +143,16 @@ MainWindow::MainWindow(QWidget *parent)
     frameLayout->addWidget(platformViewer);
     leftLayout->addWidget(modelFrame, 2);
 
+    // Wybor IMU porownywanego z IMU odniesienia
+    QHBoxLayout *compareLayout = new QHBoxLayout();
+    compareLabel = new QLabel();
+    compareComboBox = new QComboBox();
+    compareComboBox->setMinimumWidth(90);
+    compareLayout->addWidget(compareLabel);
+    compareLayout->addWidget(compareComboBox);
+    compareLayout->addStretch();
+    leftLayout->addLayout(compareLayout);
+
     // Wykres bledow IMU
     errorPlotWidget = new ImuErrorPlotWidget();
     leftLayout->addWidget(errorPlotWidget, 2);
@@ -98,11 +174,8 @@ MainWindow::MainWindow(QWidget *parent)
     imuFrame->setFrameShape(QFrame::Box);
     imuFrame->setStyleSheet("QFrame { border: 1px solid #444444; border-radius: 4px; }");
 
-    QVBoxLayout* imuLayout = new QVBoxLayout(imuFrame);
-    imu1Display = new IMUDisplay(0);  // IMU nr 1
-    imu2Display = new IMUDisplay(1);  // IMU nr 2
-    imuLayout->addWidget(imu1Display);
-    imuLayout->addWidget(imu2Display);
+    // Wyswietlacze IMU tworzone przy pierwszej probce danego IMU
+    imuGrid = new QGridLayout(imuFrame);
 
     // Layout czujnikow
     QHBoxLayout* sensorLayout = new QHBoxLayout();
@@ -117,246 +190,584 @@ MainWindow::MainWindow(QWidget *parent)
     mainLayout->addLayout(leftLayout, 3);
     mainLayout->addLayout(rightLayout, 2);
 
+    // Sondy opoznien (od przyjscia bajtow do narysowania)
+    auto probe = [this](LatencyMonitor::Stage stage) {
+        latencyProbes[stage] = new LatencyProbe(latency, stage, this);
+        return latencyProbes[stage];
+    };
+    platformViewer->setLatencyProbe(probe(LatencyMonitor::PlatformView));
+    gForceWidget->installEventFilter(probe(LatencyMonitor::GForce));
+    errorPlotWidget->setLatencyProbe(probe(LatencyMonitor::ErrorPlot));
+    hexagonBars->installEventFilter(probe(LatencyMonitor::ServoBars));
+
+    latencyPanel = new LatencyPanel(latency, this);
+    statisticsPanel = new StatisticsPanel(statistics, this);
+    spectrumPanel = new SpectrumPanel(spectrum, imus, this);
+
     setCentralWidget(centralWidget);
     resize(800, 700);
 
     // Inicjalizacja portow
     refreshPorts();
-    updateConnectionStatus(false);
+    updateConnectionStatus();
 
     // Polaczenia sygnalow
     connect(refreshButton, &QPushButton::clicked, this, &MainWindow::refreshPorts);
     connect(connectButton, &QPushButton::clicked, this, &MainWindow::toggleConnection);
-    connect(serial, &QSerialPort::readyRead, this, &MainWindow::readSerialData, Qt::QueuedConnection);
+    connect(recordButton, &QPushButton::clicked, this, &MainWindow::toggleRecording);
+    connect(replayButton, &QPushButton::clicked, this, &MainWindow::openReplay);
+    connect(pauseButton, &QPushButton::clicked, this, &MainWindow::toggleReplayPause);
+    connect(speedComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::applyReplaySpeed);
+    connect(compareComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &MainWindow::selectComparedImu);
+    connect(latencyButton, &QPushButton::clicked, this, [this]() {
+        latencyPanel->show();
+        latencyPanel->raise();
+    });
+    connect(latencyPanel, &LatencyPanel::resetRequested, this, [this]() { latency.reset(); });
+    connect(statisticsButton, &QPushButton::clicked, this, [this]() {
+        statisticsPanel->show();
+        statisticsPanel->raise();
+    });
+    connect(statisticsPanel, &StatisticsPanel::resetRequested, this, [this]() { statistics.reset(); });
+    connect(spectrumButton, &QPushButton::clicked, this, [this]() {
+        spectrumPanel->show();
+        spectrumPanel->raise();
+    });
+
+    // Odtwarzane probki ida ta sama droga co dane z portu
+    replay->setSink([this](const PlatformSample &sample, const float *scaled) { processSample(sample, scaled); });
+    replay->setConverter([this](int32_t id) { return imus.converter(id); });  // Zakresy IMU jak przy odczycie z portu
+    connect(replay, &SessionReplay::progress, this, [this](double position, double duration) {
+        replayPosition = position;
+        replayDuration = duration;
+        updateReplayStatus();
+    });
+    connect(replay, &SessionReplay::throughput, this, [this](double samplesPerSecond) {
+        replayThroughput = samplesPerSecond;
+        updateReplayStatus();
+    });
+    connect(replay, &SessionReplay::finished, this, [this](quint64 samples, double seconds) {
+        qInfo().nospace() << "Replay finished: " << samples << " samples in " << seconds << " s ("
+                          << (seconds > 0 ? samples / seconds : 0.0) << " samples/s)";
+        replay->stop();
+        replayButton->setText(tr("Replay..."));
+        pauseButton->setEnabled(false);
+        replayLabel->setText(tr("Finished: %1 samples/s").arg(seconds > 0 ? samples / seconds : 0.0, 0, 'f', 0));
+        if (quitAfterReplay) qApp->quit();
+    });
+    connect(frameScheduler, &FrameScheduler::frame, this, &MainWindow::flushFrame);
+    connect(portComboBox, &QComboBox::currentTextChanged, this, &MainWindow::updateConnectButton);
+
+    // Scalanie kolejek portow - ponowienie, gdy inny port jest w trakcie paczki
+    mergeRetryTimer->setSingleShot(true);
+    mergeRetryTimer->setInterval(1);
+    connect(mergeRetryTimer, &QTimer::timeout, this, &MainWindow::drainSamples);
+
+    portStatsTimer->setInterval(1000);
+    connect(portStatsTimer, &QTimer::timeout, this, &MainWindow::updateConnectionStatus);
 
 retranslateUi();
 
 }
 
-// Odczyt danych z portu szeregowego
-void MainWindow::readSerialData() {
-    static QByteArray buffer;
-    buffer += serial->readAll();
-
-    // Przetwarzanie linii danych
-    while (true) {
-        const int lineEnd = buffer.indexOf('\n');
-        if (lineEnd == -1) break;
-
-        QByteArray line = buffer.left(lineEnd).trimmed();
-        buffer.remove(0, lineEnd + 1);
-        if (line.isEmpty()) continue;
-
-        // Przetwarzanie danych IMU
-        if (line.startsWith("IMU:") && line.contains('*')) {
-            const int crcPos = line.lastIndexOf('*');
-            const QByteArray dataPart = line.mid(4, crcPos - 4);
-            const QByteArray crcPart = line.mid(crcPos + 1);
-
-            bool crcOk;
-            const uint8_t receivedCrc = crcPart.toUInt(&crcOk, 16);
-            if (!crcOk || crcPart.length() != 2) {
-                qWarning() << "Invalid CRC format:" << line;
-                continue;
-            }
-
-            const QList<QByteArray> values = dataPart.split(',');
-            if (values.size() != 7) {
-                qWarning() << "Invalid data field count:" << line;
-                continue;
-            }
+// Odbior probek zdekodowanych w watkach czytnikow (scalone wedlug czasu)
+void MainWindow::drainSamples() {
+    for (const Port &port : ports) {
+        port.reader->rearmNotification();
+    }
 
-            const uint8_t calculatedCrc = calculateCrc8(values.mid(1, 6));
-            if (receivedCrc != calculatedCrc) {
-                qWarning() << "CRC mismatch. Received:" << receivedCrc << "Calculated:" << calculatedCrc;
-                continue;
-            }
+    const qint64 now = monotonicNowNs();
+    const bool held = merger.drain([this, now](const PlatformSample &sample) {
+        latency.record(LatencyMonitor::Dispatch, sample.timestampNs, now);
+        processSample(sample);
+    });
 
-            // Konwersja danych
-            bool conversionOk[7];
-            const int imuId = values[0].toInt(&conversionOk[0]);
-            const int16_t fax = values[1].toInt(&conversionOk[1]);
-            const int16_t fay = values[2].toInt(&conversionOk[2]);
-            const int16_t faz = values[3].toInt(&conversionOk[3]);
-            const int16_t fgx = values[4].toInt(&conversionOk[4]);
-            const int16_t fgy = values[5].toInt(&conversionOk[5]);
-            const int16_t fgz = values[6].toInt(&conversionOk[6]);
-
-            if (!std::all_of(std::begin(conversionOk), std::end(conversionOk), [](bool ok) { return ok; })) {
-                qWarning() << "Invalid IMU data conversion:" << line;
-                continue;
-            }
+    // Czesc probek czeka na paczke innego portu
+    if (held && !mergeRetryTimer->isActive())
+        mergeRetryTimer->start();
+}
 
-            // Aktualizacja GUI
-            QMetaObject::invokeMethod(this, [=]() {
-                if (imuId == 1) {
-                    // Aktualizacja platformy
-                    platformViewer->updatePlatformOrientation(fax, fay, faz);
-
-                    // Skalowanie danych IMU1
-                    imu1.ax = fax*0.000565;
-                    imu1.ay = fay*0.000565;
-                    imu1.az = faz*0.000565;
-                    imu1.gx = fgx/65.5f*M_PI/180.0f;
-                    imu1.gy = fgy/65.5f*M_PI/180.0f;
-                    imu1.gz = fgz/65.5f*M_PI/180.0f;
-                    if(!imu1.valid) imu1.valid=1;
-
-                    // Aktualizacja wyswietlacza
-                    imu1Display->updateValues(imu1.ax, imu1.ay, imu1.az, imu1.gx, imu1.gy, imu1.gz);
-
-                    // Przeliczenie przyspieszen
-                    float gX = static_cast<float>(fax) / 16390.0f;
-                    float gY = static_cast<float>(fay) / 16390.0f;
-                    gForceWidget->setAcceleration(gX, gY);
-                } else if (imuId == 2) {
-                    // Dane IMU2
-                    imu2.ax = fax*0.000565;
-                    imu2.ay = fay*0.000565;
-                    imu2.az = faz*0.000565;
-                    imu2.gx = fgx/65.5f*M_PI/180.0f;
-                    imu2.gy = fgy/65.5f*M_PI/180.0f;
-                    imu2.gz = fgz/65.5f*M_PI/180.0f;
-                    imu2Display->updateValues(imu2.ax, imu2.ay, imu2.az, imu2.gx, imu2.gy, imu2.gz);
-                    if(!imu2.valid) imu2.valid=1;
-                } else {
-                    qWarning() << "Unknown IMU ID:" << imuId;
-                }
-
-                // Obliczanie roznic miedzy IMU
-                if (imu1.valid && imu2.valid) {
-                    const float dax = imu1.ax - imu2.ax;
-                    const float day = imu1.ay - imu2.ay;
-                    const float daz = imu1.az - imu2.az;
-                    const float dgx = imu1.gx - imu2.gx;
-                    const float dgy = imu1.gy - imu2.gy;
-                    const int dgz = imu1.gz - imu2.gz;
-
-                    errorPlotWidget->addErrorSample(dax, day, daz, dgx, dgy, dgz);
-                }
-            }, Qt::QueuedConnection);
-        }
-        else if (line.startsWith("S:") && line.contains('*')) {
-            // Przetwarzanie danych serw
-            const int crcPos = line.lastIndexOf('*');
-            const QByteArray dataPart = line.mid(2, crcPos - 2);
-            const QByteArray crcPart = line.mid(crcPos + 1);
-
-            bool crcOk;
-            const uint8_t receivedCrc = crcPart.toUInt(&crcOk, 16);
-            if (!crcOk || crcPart.length() != 2) {
-                qWarning() << "Invalid CRC format in servo line:" << line;
-                continue;
-            }
+// Zapamietanie probki do najblizszej klatki
+void MainWindow::processSample(const PlatformSample &sample, const float *scaled) {
+    // Obsluga wedlug typu ramki, w kolejnosci AsciiFrames (nowy typ bez obslugi nie kompiluje sie)
+    dispatchSample(AsciiFrames(), sample,
+                   [this, scaled](const PlatformSample &imu) { processImuSample(imu, scaled); },
+                   [this](const PlatformSample &servo) { processServoSample(servo); });
+}
 
-            const QList<QByteArray> values = dataPart.split(',');
-            if (values.size() != 6) {
-                qWarning() << "Invalid servo data field count:" << line;
-                continue;
-            }
+// Probka serw - katy i poza platformy
+void MainWindow::processServoSample(const PlatformSample &sample) {
+    pending.mark(LatencyMonitor::DisplayFrame, sample.timestampNs);
 
-            uint8_t calculatedCrc = calculateCrc8(values);
-            if (receivedCrc != calculatedCrc) {
-                qWarning() << "Servo CRC mismatch. Received:" << receivedCrc << "Calculated:" << calculatedCrc;
-                continue;
-            }
+    // Tylko ostatnie katy serw
+    double angles[6];
+    for (int i = 0; i < 6; ++i) {
+        pending.servoAngles[i] = sample.values[i];
+        angles[i] = sample.values[i];
+    }
+    pending.servoDirty = true;
 
-            bool conversionOk[6];
-            QVector<int> servoAngles(6);
-            for (int i = 0; i < 6; ++i) {
-                servoAngles[i] = values[i].toInt(&conversionOk[i]);
-            }
+    // Poza platformy z katow serw - kazda ramka (start od poprzedniego rozwiazania)
+    if (servoKinematics.forward(angles, pending.servoPose)) {
+        pending.servoPoseDirty = true;
+        pending.mark(LatencyMonitor::PlatformView, sample.timestampNs);
+    }
+    pending.mark(LatencyMonitor::ServoBars, sample.timestampNs);
+    frameScheduler->requestFrame();
+}
 
-            if (!std::all_of(std::begin(conversionOk), std::end(conversionOk), [](bool ok) { return ok; })) {
-                qWarning() << "Invalid servo angle conversion:" << line;
-                continue;
+// Probka IMU - stan czujnika, statystyki i dane wykresow
+void MainWindow::processImuSample(const PlatformSample &sample, const float *scaled) {
+    pending.mark(LatencyMonitor::DisplayFrame, sample.timestampNs);
+
+    // Slot IMU z tablicy (nowe IMU dostaje wyswietlacz przy pierwszej probce)
+    int slot = imus.slotOf(sample.imuId);
+    if (slot < 0) {
+        slot = imus.add(sample.imuId);
+        if (slot < 0) {
+            // Ostrzezenie raz na identyfikator - kolejne probki odrzucane bez logowania
+            const bool inRange = sample.imuId >= 0 && sample.imuId <= ImuBank::kMaxId;
+            const std::size_t bit = inRange ? static_cast<std::size_t>(sample.imuId) : ImuBank::kMaxId + 1;
+            if (!rejectedImuIds.test(bit)) {
+                rejectedImuIds.set(bit);
+                qWarning() << "Unknown IMU ID:" << sample.imuId;
             }
+            return;
+        }
+        addImu(slot);
+    }
+    imus.store(slot, sample, scaled);
+
+    // Statystyki kazdej osi (kazda probka)
+    float values[ImuBank::ChannelCount];
+    imus.values(slot, values);
+    statistics.updateImu(slot, values, sample.timestampNs);
+
+    // Widmo - tylko przy otwartym panelu, FFT w watku analizatora
+    if (spectrum.running())
+        spectrum.push(slot, values, sample.timestampNs);
+
+    if (sample.imuId == referenceImuId) {
+        // Orientacja platformy - filtr w ImuBank, do widoku tylko stan koncowy
+        pending.platformDirty = true;
+        pending.mark(LatencyMonitor::PlatformView, sample.timestampNs);
+
+        // Przeliczenie przyspieszen (wszystkie probki do sladu)
+        float gX = imus.value(ImuBank::AccelX, slot) / kStandardGravity;
+        float gY = imus.value(ImuBank::AccelY, slot) / kStandardGravity;
+        pending.gForce.append(ImuGForceWidget::Sample{ sample.timestampNs, QPointF(gX, gY) });
+        pending.mark(LatencyMonitor::GForce, sample.timestampNs);
+    }
 
-            // Aktualizacja paskow serw
-            QMetaObject::invokeMethod(this, [=]() {
-                for(int i=0;i<6;i++) {
-                    // hexagonBars->setBarValue(i, (servoAngles[i]+90.0f)/180.0f);
-                    hexagonBars->updateServoAngles(servoAngles);
-                }
-            }, Qt::QueuedConnection);
-        } else {
-            qDebug() << "Received unrecognized data:" << line;
+    // Roznice wybranego IMU wzgledem IMU odniesienia (wszystkie probki do wykresu)
+    const int referenceSlot = imus.slotOf(referenceImuId);
+    if ((slot == referenceSlot || slot == compareSlot) && referenceSlot >= 0 && compareSlot >= 0
+        && imus.valid(referenceSlot) && imus.valid(compareSlot)) {
+        ImuErrorPlotWidget::Sample error;
+        error.timestampNs = sample.timestampNs;
+        for (int i = 0; i < 3; ++i) {
+            const auto accel = static_cast<ImuBank::Channel>(ImuBank::AccelX + i);
+            const auto gyro = static_cast<ImuBank::Channel>(ImuBank::GyroX + i);
+            error.accel[i] = imus.value(accel, referenceSlot) - imus.value(accel, compareSlot);
+            error.gyro[i] = imus.value(gyro, referenceSlot) - imus.value(gyro, compareSlot);
         }
+        pending.errors.append(error);
+
+        const float difference[ImuBank::ChannelCount] = { error.accel[0], error.accel[1], error.accel[2],
+                                                          error.gyro[0], error.gyro[1], error.gyro[2] };
+        statistics.updateDifference(difference, sample.timestampNs);
+        pending.mark(LatencyMonitor::ErrorPlot, sample.timestampNs);
     }
+
+    frameScheduler->requestFrame();
 }
 
-// Obliczanie sumy kontrolnej CRC8
-uint8_t MainWindow::calculateCrc8(const QList<QByteArray>& data) {
-    uint8_t crc = 0xFF;
-    const uint8_t poly = 0x31;
-
-    for (const QByteArray& valStr : data) {
-        bool ok;
-        int16_t value = valStr.toInt(&ok);
-        if (!ok) {
-            qWarning() << "Invalid int16 value:" << valStr;
-            return 0;
-        }
+// Wyswietlacz i pozycja na liscie porownan dla nowego IMU
+void MainWindow::addImu(int slot) {
+    const int32_t id = imus.id(slot);
+
+    IMUDisplay *display = new IMUDisplay(id);
+    LatencyProbe *probe = new LatencyProbe(latency, LatencyMonitor::ImuDisplays, display);
+    display->setLatencyProbe(probe);
+    imuDisplays.append(display);
+    imuProbes.append(probe);
+    layoutImuDisplays();
+    statistics.addImu(id);
+
+    // Pierwsze dodane IMU zostaje automatycznie wybrane do porownania
+    if (id != referenceImuId)
+        compareComboBox->addItem(QString("IMU %1").arg(id), slot);
+}
 
-        // Obliczenia CRC
-        uint8_t lsb = static_cast<uint8_t>(value & 0xFF);
-        uint8_t msb = static_cast<uint8_t>((value >> 8) & 0xFF);
+// Rozmieszczenie wyswietlaczy wedlug numeru IMU (po cztery w kolumnie)
+void MainWindow::layoutImuDisplays() {
+    QVector<int> order(imuDisplays.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](int a, int b) { return imus.id(a) < imus.id(b); });
 
-        for (uint8_t byte : {lsb, msb}) {
-            crc ^= byte;
-            for (uint8_t j = 0; j < 8; j++) {
-                crc = (crc & 0x80) ? ((crc << 1) ^ poly) : (crc << 1);
-            }
-        }
+    for (IMUDisplay *display : imuDisplays)
+        imuGrid->removeWidget(display);
+    for (int i = 0; i < order.size(); ++i)
+        imuGrid->addWidget(imuDisplays[order[i]], i % 4, i / 4);
+}
+
+// Zmiana IMU porownywanego na wykresie bledow
+void MainWindow::selectComparedImu() {
+    const QVariant data = compareComboBox->currentData();
+    compareSlot = data.isValid() ? data.toInt() : -1;
+    pending.errors.clear();
+    errorPlotWidget->clear();
+    statistics.resetDifference();
+}
+
+// Przekazanie zebranego stanu do widgetow (raz na klatke)
+void MainWindow::flushFrame() {
+    if (pending.sourceNs[LatencyMonitor::DisplayFrame] != 0)
+        latency.record(LatencyMonitor::DisplayFrame, pending.sourceNs[LatencyMonitor::DisplayFrame], monotonicNowNs());
+
+    if (pending.platformDirty) {
+        const MadgwickFilter &orientation = imus.orientation(imus.slotOf(referenceImuId));
+        platformViewer->setPlatformOrientation(orientation.w(), orientation.x(), orientation.y(), orientation.z());
+        pending.platformDirty = false;
+    }
+
+    // Tylko IMU zmienione od poprzedniej klatki
+    for (int slot : imus.dirtySlots()) {
+        float values[ImuBank::ChannelCount];
+        imus.values(slot, values);
+        imuDisplays[slot]->updateValues(values[0], values[1], values[2], values[3], values[4], values[5]);
+        imuProbes[slot]->mark(imus.pendingNs(slot));
+    }
+    imus.clearDirty();
+
+    if (!pending.gForce.isEmpty()) {
+        // Bufor sladu wg zmierzonej czestotliwosci IMU odniesienia (25% zapasu w widgecie)
+        const float period = imus.samplePeriod(imus.slotOf(referenceImuId));
+        const double sizedRate = gForceWidget->expectedSampleRate();
+        if (period > 0.0f && (1.0 / period > sizedRate * 1.1 || 1.0 / period < sizedRate * 0.5))
+            gForceWidget->setExpectedSampleRate(1.0 / period);
+
+        gForceWidget->addAccelerationSamples(pending.gForce);
+        pending.gForce.clear();
+    }
+
+    if (!pending.errors.isEmpty()) {
+        errorPlotWidget->addErrorSamples(pending.errors);
+        pending.errors.clear();
     }
-    return crc;
+
+    if (pending.servoDirty) {
+        hexagonBars->updateServoAngles(pending.servoAngles);
+        pending.servoDirty = false;
+    }
+
+    if (pending.servoPoseDirty) {
+        platformViewer->setServoPose(pending.servoPose);
+        pending.servoPoseDirty = false;
+    }
+
+    // Czas przyjscia najstarszych danych trafia do sond - zapis przy rysowaniu
+    for (int stage = LatencyMonitor::PlatformView; stage < LatencyMonitor::StageCount; ++stage) {
+        if (pending.sourceNs[stage] != 0 && latencyProbes[stage])
+            latencyProbes[stage]->mark(pending.sourceNs[stage]);
+    }
+    std::fill(std::begin(pending.sourceNs), std::end(pending.sourceNs), 0);
+}
+
+// Czestotliwosc odswiezania widgetow
+void MainWindow::setDisplayRate(double hz) {
+    frameScheduler->setRate(hz);
 }
 
 // Odswiezanie listy portow COM
 void MainWindow::refreshPorts()
 {
+    // Wpisana recznie sciezka (np. /tmp/ttyPLATFORM) zostaje na liscie
+    const QString current = portComboBox->currentText();
+
     portComboBox->clear();
     const auto ports = QSerialPortInfo::availablePorts();
     for (const QSerialPortInfo &port : ports) {
         portComboBox->addItem(port.portName());
     }
+
+    if (current.startsWith('/') && portComboBox->findText(current) < 0) {
+        portComboBox->addItem(current);
+        portComboBox->setCurrentText(current);
+    }
 }
 
-// Polaczenie/rozlaczenie z portem
+// Otwarcie/zamkniecie wybranego portu
 void MainWindow::toggleConnection()
 {
-    if (serial->isOpen()) {
-        serial->close();
-        updateConnectionStatus(false);
-        connectButton->setText(tr("Connect"));
-        return;
-    }
-
     QString portName = portComboBox->currentText();
     if (portName.isEmpty()) {
         QMessageBox::warning(this, tr("Error"), tr("No port selected!"));
         return;
     }
 
-    serial->setPortName(portName);
-    serial->setBaudRate(QSerialPort::Baud115200);
+    const int index = findPort(portName);
+    if (index >= 0) {
+        closePort(index);
+        return;
+    }
+
+    const qint32 baudRate = baudComboBox->currentText().toInt();
+    if (baudRate <= 0) {
+        QMessageBox::warning(this, tr("Error"), tr("Invalid baud rate!"));
+        return;
+    }
+
+    openPort(portName, baudRate);
+}
 
-    if (serial->open(QIODevice::ReadWrite)) {
-        updateConnectionStatus(true);
-        connectButton->setText(tr("Disconnect"));
+// Nowy port z wlasnym watkiem czytnika
+void MainWindow::openPort(const QString &name, qint32 baudRate)
+{
+    Port port;
+    port.name = name;
+    port.thread = new QThread(this);
+    port.thread->setObjectName("SerialReader " + name);
+    port.reader = new SerialReader();
+    port.reader->setLatencyMonitor(&latency);
+    port.reader->moveToThread(port.thread);
+
+    SerialReader *reader = port.reader;
+    connect(reader, &SerialReader::samplesAvailable, this, &MainWindow::drainSamples, Qt::QueuedConnection);
+    connect(reader, &SerialReader::connectionChanged, this, [this, reader](bool isConnected, const QString &error) {
+        onConnectionChanged(reader, isConnected, error);
+    }, Qt::QueuedConnection);
+    connect(reader, &SerialReader::protocolChanged, this, [this, reader](const QString &protocol) {
+        const int index = findPort(reader);
+        if (index < 0) return;
+        ports[index].protocol = protocol;
+        updateConnectionStatus();
+    }, Qt::QueuedConnection);
+
+    // Nagrywanie w watku czytnika, przed kolejka GUI
+    port.recorderInput = recorder.addInput(&reader->busySinceNs());
+    reader->setRecorderInput(port.recorderInput);
+
+    merger.addSource(&reader->queue(), &reader->busySinceNs());
+    ports.append(port);
+    port.thread->start();
+
+    // Port otwierany jest w watku czytnika
+    QMetaObject::invokeMethod(reader, [reader, name, baudRate]() {
+        reader->open(name, baudRate);
+    }, Qt::QueuedConnection);
+
+    updateConnectButton();
+}
+
+// Zamkniecie portu i zatrzymanie jego watku
+void MainWindow::closePort(int index)
+{
+    const Port port = ports[index];
+    QMetaObject::invokeMethod(port.reader, &SerialReader::close, Qt::BlockingQueuedConnection);
+    port.thread->quit();
+    port.thread->wait();
+
+    // Probki pozostale w kolejce trafiaja jeszcze do widgetow - wszystkie, takze nowsze
+    // od paczki innego portu (kolejka znika razem z czytnikiem)
+    drainSamples();
+    const qint64 now = monotonicNowNs();
+    merger.drainSource(&port.reader->queue(), [this, now](const PlatformSample &sample) {
+        latency.record(LatencyMonitor::Dispatch, sample.timestampNs, now);
+        processSample(sample);
+    });
+    merger.removeSource(&port.reader->queue());
+    recorder.removeInput(port.recorderInput);
+    ports.removeAt(index);
+
+    delete port.reader;
+    delete port.thread;
+
+    if (ports.isEmpty()) portStatsTimer->stop();
+    updateConnectionStatus();
+    updateConnectButton();
+}
+
+// Wyszukiwanie portu po nazwie
+int MainWindow::findPort(const QString &name) const
+{
+    for (int i = 0; i < ports.size(); ++i) {
+        if (ports[i].name == name) return i;
+    }
+    return -1;
+}
+
+// Wyszukiwanie portu po czytniku
+int MainWindow::findPort(const SerialReader *reader) const
+{
+    for (int i = 0; i < ports.size(); ++i) {
+        if (ports[i].reader == reader) return i;
+    }
+    return -1;
+}
+
+// Wynik otwarcia/zamkniecia portu zgloszony przez czytnik
+void MainWindow::onConnectionChanged(SerialReader *reader, bool isConnected, const QString &error)
+{
+    const int index = findPort(reader);
+    if (index < 0) return;
+
+    ports[index].connected = isConnected;
+    ports[index].protocol.clear();
+    if (isConnected) portStatsTimer->start();
+    updateConnectionStatus();
+
+    if (!error.isEmpty()) {
+        const QString name = ports[index].name;
+        closePort(index);
+        QMessageBox::critical(this, QObject::tr("Error"), tr("Failed to open port: ") + name + ": " + error);
+    }
+}
+
+// Tekst przycisku zalezny od stanu wybranego portu
+void MainWindow::updateConnectButton()
+{
+    connectButton->setText(findPort(portComboBox->currentText()) >= 0 ? tr("Disconnect") : tr("Connect"));
+}
+
+// Rozpoczecie/zakonczenie nagrywania sesji
+void MainWindow::toggleRecording()
+{
+    if (recorder.isRecording()) {
+        recorder.stop();
+        qDebug() << "Session saved:" << recorder.path() << "samples:" << recorder.recordedSamples()
+                 << "dropped:" << recorder.droppedSamples();
+        recordButton->setText(tr("Record"));
+        return;
+    }
+
+    const QString defaultName = QDir::currentPath() + "/session_"
+                                + QDateTime::currentDateTime().toString("yyyyMMdd_HHmmss") + ".wds";
+    const QString path = QFileDialog::getSaveFileName(this, tr("Save Session"), defaultName,
+                                                      tr("Platform sessions (*.wds)"));
+    if (path.isEmpty()) return;
+
+    // Dane zapisywane sa przez watek rejestratora
+    QString error;
+    if (!recorder.start(path, &error)) {
+        QMessageBox::critical(this, QObject::tr("Error"), tr("Failed to start recording: ") + error);
+        return;
+    }
+    recordButton->setText(tr("Stop Recording"));
+}
+
+// Wybor pliku sesji i start odtwarzania (lub zatrzymanie)
+void MainWindow::openReplay()
+{
+    if (replay->isOpen()) {
+        replay->stop();
+        replayButton->setText(tr("Replay..."));
+        pauseButton->setEnabled(false);
+        replayLabel->clear();
+        return;
+    }
+
+    const QString path = QFileDialog::getOpenFileName(this, tr("Open Session"), QDir::currentPath(),
+                                                      tr("Platform sessions (*.wds)"));
+    if (path.isEmpty()) return;
+
+    startReplay(path, speedComboBox->currentData().toDouble());
+}
+
+// Start odtwarzania sesji
+bool MainWindow::startReplay(const QString &path, double speed, bool quitWhenDone)
+{
+    QString error;
+    if (!replay->open(path, &error)) {
+        // Test obciazeniowy bez obslugi - blad na stderr zamiast okna dialogowego
+        if (quitWhenDone)
+            qCritical().noquote() << "Failed to open session:" << error;
+        else
+            QMessageBox::critical(this, QObject::tr("Error"), tr("Failed to open session: ") + error);
+        return false;
+    }
+
+    // Predkosc (0 = najszybciej jak to mozliwe); wartosc spoza listy dopisywana jako wlasna pozycja
+    const double value = speed > 0 ? qBound(1.0, speed, 100.0) : 0.0;
+    int index = speedComboBox->findData(value);
+    if (index < 0) {
+        index = 0;
+        while (index < speedComboBox->count() - 1 && speedComboBox->itemData(index).toDouble() < value)
+            ++index;
+        speedComboBox->insertItem(index, QString("%1x").arg(value), value);
+    }
+    speedComboBox->setCurrentIndex(index);
+    applyReplaySpeed();
+
+    quitAfterReplay = quitWhenDone;
+    replayPosition = 0;
+    replayDuration = replay->duration();
+    replayThroughput = 0;
+
+    replay->play();
+    replayButton->setText(tr("Stop Replay"));
+    pauseButton->setText(tr("Pause"));
+    pauseButton->setEnabled(true);
+    updateReplayStatus();
+    return true;
+}
+
+// Wstrzymanie/wznowienie odtwarzania
+void MainWindow::toggleReplayPause()
+{
+    if (replay->isPlaying()) {
+        replay->pause();
+        pauseButton->setText(tr("Resume"));
     } else {
-        QMessageBox::critical(this, QObject::tr("Error"), tr("Failed to open port: ") + serial->errorString());
+        replay->play();
+        pauseButton->setText(tr("Pause"));
     }
 }
 
+// Zmiana predkosci odtwarzania
+void MainWindow::applyReplaySpeed()
+{
+    const double speed = speedComboBox->currentData().toDouble();
+    replay->setFastMode(speed <= 0);
+    if (speed > 0) replay->setSpeed(speed);
+    replayThroughput = 0;
+    updateReplayStatus();
+}
+
+// Pozycja odtwarzania i przepustowosc
+void MainWindow::updateReplayStatus()
+{
+    if (!replay->isOpen()) {
+        replayLabel->clear();
+        return;
+    }
+
+    QString text = QString("%1 / %2 s").arg(replayPosition, 0, 'f', 1).arg(replayDuration, 0, 'f', 1);
+    if (replayThroughput > 0)
+        text += QString("  (%1 ").arg(replayThroughput, 0, 'f', 0) + tr("samples/s") + ")";
+    replayLabel->setText(text);
+}
+
 // Aktualizacja statusu polaczenia
-void MainWindow::updateConnectionStatus(bool connected)
+void MainWindow::updateConnectionStatus()
 {
-    if (connected) {
-        statusLabel->setText(tr("\u2713 Connected to ") + portComboBox->currentText());
+    QStringList names;
+    QStringList counters;
+    for (const Port &port : ports) {
+        if (!port.connected) continue;
+        names << (port.protocol.isEmpty() ? port.name : port.name + " [" + port.protocol + "]");
+        counters << QString("%1: %2 ").arg(port.name).arg(port.reader->validFrames()) + tr("frames") + ", "
+                        + QString("%1 ").arg(port.reader->rejectedFrames()) + tr("errors") + ", "
+                        + QString("%1 ").arg(port.reader->droppedSamples()) + tr("dropped");
+    }
+
+    if (!names.isEmpty()) {
+        statusLabel->setText(tr("\u2713 Connected to ") + names.join(", "));
+        statusLabel->setToolTip(counters.join("\n"));
         statusLabel->setStyleSheet("QLabel { color: green; font-weight: bold; }");
     } else {
         statusLabel->setText(tr("\u2717 Disconnected"));
+        statusLabel->setToolTip(QString());
         statusLabel->setStyleSheet("QLabel { color: red; font-weight: bold; }");
     }
 }
@@ -364,8 +775,20 @@ void MainWindow::updateConnectionStatus(bool connected)
 // Destruktor
 MainWindow::~MainWindow()
 {
-    if (serial->isOpen()) {
-        serial->close();
+    // Zapis sesji, zamkniecie portow i zatrzymanie watkow czytnikow
+    recorder.stop();
+    while (!ports.isEmpty()) {
+        closePort(ports.size() - 1);
+    }
+
+    // Raport opoznien (opcja --latency-dump)
+    if (!latencyDumpPath.isEmpty()) {
+        QFile file(latencyDumpPath);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+            file.write(latency.report().c_str());
+        } else {
+            qWarning() << "Cannot write latency report:" << file.errorString();
+        }
     }
 }
 
@@ -398,12 +821,24 @@ void MainWindow::retranslateUi() {
     refreshButton->setText(tr("Refresh Ports"));
 
     // Ten przycisk ma tekst zależny od stanu połączenia
-    connectButton->setText(serial->isOpen() ? tr("Disconnect") : tr("Connect"));
-
-    updateConnectionStatus(serial->isOpen());
+    updateConnectButton();
+    recordButton->setText(recorder.isRecording() ? tr("Stop Recording") : tr("Record"));
+    replayButton->setText(replay->isOpen() ? tr("Stop Replay") : tr("Replay..."));
+    pauseButton->setText(replay->isOpen() && !replay->isPlaying() ? tr("Resume") : tr("Pause"));
+    speedComboBox->setItemText(speedComboBox->count() - 1, tr("Max"));
+    latencyButton->setText(tr("Latency"));
+    statisticsButton->setText(tr("Statistics"));
+    spectrumButton->setText(tr("Spectrum"));
+
+    updateConnectionStatus();
+    updateReplayStatus();
 
     platformViewer->retranslateUi();
-    imu1Display->retranslateUi();
-    imu2Display->retranslateUi();
+    compareLabel->setText(tr("Error plot: IMU %1 minus").arg(referenceImuId));
+    for (IMUDisplay *display : imuDisplays)
+        display->retranslateUi();
     errorPlotWidget->retranslateUi();
+    latencyPanel->retranslateUi();
+    statisticsPanel->retranslateUi();
+    spectrumPanel->retranslateUi();
 }
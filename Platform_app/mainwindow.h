@@ -23,7 +23,24 @@
 #include <QApplication>
 #include <QTranslator>
 #include <QDir>
+#include <QThread>
+#include <QTimer>
+#include <QGridLayout>
 
+#include <bitset>
+
+#include "FrameScheduler.h"
+#include "ImuBank.h"
+#include "LatencyMonitor.h"
+#include "LatencyPanel.h"
+#include "LatencyProbe.h"
+#include "SampleMerger.h"
+#include "SerialReader.h"
+#include "SessionRecorder.h"
+#include "SessionReplay.h"
+#include "StatisticsPanel.h"
+#include "SpectrumPanel.h"
+#include "StewartKinematics.h"
 #include "platformviewer.h"
 #include "imudisplay.h"
 #include "hexagon.h"
@@ -35,9 +52,10 @@
  * @brief Central widget managing IMU data visualization and serial communication
  *
  * @details The MainWindow class provides:
- *          - Serial port management for IMU communication
+ *          - Several serial ports at once, each read on its own thread
  *          - Real-time 3D visualization of platform orientation
- *          - Dual IMU data comparison and error plotting
+ *          - Any number of IMUs, with displays created on first data
+ *          - Error plotting of a selected IMU against the reference IMU
  *          - Servo position visualization
  *          - G-force vector display
  *
@@ -66,12 +84,55 @@ public:
      * @brief Destructor ensuring proper resource cleanup
      *
      * @details Automatically:
-     *          - Closes serial port connection if open
+     *          - Finishes a running session recording
+     *          - Closes all open serial ports
+     *          - Stops the serial reader threads
      *          - Releases all dynamically allocated resources
      *          - Maintains Qt object hierarchy
      */
     ~MainWindow() override;
 
+    /**
+     * @brief Sets how often the widgets are refreshed
+     * @param hz Frames per second; 0 follows the screen refresh rate
+     *
+     * @details Samples arriving between two frames are accumulated and
+     *          shown together, so GUI cost scales with the frame rate
+     *          rather than with the sample rate.
+     */
+    void setDisplayRate(double hz);
+
+    /**
+     * @brief Plays a recorded session through the visualization widgets
+     * @param path Session file
+     * @param speed Playback speed (1-100), 0 for as fast as possible; a speed
+     *        missing from the speed list is added to it
+     * @param quitWhenDone Close the application after the last sample; an
+     *        open error is then printed to stderr instead of a dialog
+     * @return false if the file could not be opened
+     *
+     * @details Replayed samples take the same path as live serial data.
+     *          The throughput of fast mode is logged when playback ends.
+     */
+    bool startReplay(const QString &path, double speed, bool quitWhenDone = false);
+
+    /**
+     * @brief Writes the latency report to a file when the window is destroyed
+     * @param path Target text file; empty disables the dump
+     */
+    void setLatencyDumpFile(const QString &path) { latencyDumpPath = path; }
+
+    /**
+     * @brief Selects the sensor range of an IMU (live and replayed samples)
+     * @param id IMU identifier
+     * @param accel Accelerometer full scale
+     * @param gyro Gyroscope full scale
+     * @return false if the id is out of range
+     *
+     * @details IMUs without a selected range use DefaultImuProfile.
+     */
+    bool setImuRange(int32_t id, AccelRange accel, GyroRange gyro) { return imus.setRange(id, accel, gyro); }
+
 private slots:
     /**
      * @brief Refreshes available serial ports list
@@ -90,88 +151,244 @@ private slots:
     void switchLanguage();
 
     /**
-     * @brief Toggles serial port connection state
+     * @brief Opens or closes the port selected in portComboBox
      *
-     * @details Manages the full connection lifecycle:
-     *          - Opens port at 115200 baud when connecting
-     *          - Properly closes port when disconnecting
-     *          - Updates UI elements to reflect connection state
-     *          - Handles connection errors gracefully
+     * @details Ports are independent: opening one starts a new reader
+     *          thread at the selected baud rate and leaves already open
+     *          ports untouched. Selecting an open port closes it.
      */
     void toggleConnection();
 
     /**
-     * @brief Processes incoming serial data
+     * @brief Consumes samples decoded by the serial reader threads
      *
-     * @details Continuously reads and parses data from the serial port,
-     *          supporting two message formats:
-     *          1. IMU data packets (format: "IMU:<id>,<ax>,<ay>,<az>,<gx>,<gy>,<gz>*<crc>")
-     *          2. Servo data packets (format: "S:<a1>,<a2>,<a3>,<a4>,<a5>,<a6>*<crc>")
+     * @details Merges the lock-free queues of all readers in timestamp
+     *          order (see SampleMerger), records the merged stream when
+     *          recording and accumulates the samples for the next display
+     *          frame. Raw bytes, framing and CRC checks never reach the GUI
+     *          thread; see SerialReader.
+     */
+    void drainSamples();
+
+    /**
+     * @brief Starts or stops session recording
      *
-     * Validates CRC checksums and updates appropriate visualization widgets.
+     * @details Asks for the target file when starting. The readers hand their
+     *          samples to the recorder before the GUI queue; a background
+     *          thread merges them by timestamp and writes the file (see
+     *          SessionRecorder).
      */
-    void readSerialData();
+    void toggleRecording();
 
     /**
-     * @brief Computes CRC-8 checksum for data validation
-     * @param data List of data fields to checksum
-     * @return Computed CRC-8 value
+     * @brief Shows "Connect" or "Disconnect" for the selected port
+     */
+    void updateConnectButton();
+
+    /**
+     * @brief Asks for a session file and starts its replay
+     */
+    void openReplay();
+
+    /**
+     * @brief Pauses or resumes the replay
+     */
+    void toggleReplayPause();
+
+    /**
+     * @brief Applies the replay speed selected in speedComboBox
+     */
+    void applyReplaySpeed();
+
+    /**
+     * @brief Shows replay position and throughput
+     */
+    void updateReplayStatus();
+
+    /**
+     * @brief Switches the error plot to the IMU selected in compareComboBox
+     */
+    void selectComparedImu();
+
+    /**
+     * @brief Pushes the state accumulated since the last frame to the widgets
      *
-     * @details Uses polynomial 0x31 (x^8 + x^5 + x^4 + 1) and processes
-     *          both LSB and MSB of each 16-bit value. Essential for data
-     *          integrity verification in serial communication.
+     * @details Called by FrameScheduler once per display frame. Each widget
+     *          is updated at most once: displays and the 3D view get the
+     *          latest values, the plots get every sample of the interval.
      */
-    uint8_t calculateCrc8(const QList<QByteArray>& data);
+    void flushFrame();
 
 private:
     /**
      * @brief Updates connection status display
-     * @param connected Current connection state (true = connected)
      *
      * @details Modifies both text and styling of the status label:
-     *          - Green checkmark and port name when connected
-     *          - Red cross when disconnected
-     *          - Updates tooltips and accessibility features
+     *          - Green checkmark with every open port and its detected protocol
+     *          - Red cross when no port is open
+     *          - Tooltip with per-port frame, error and drop counters
+     */
+    void updateConnectionStatus();
+
+    /**
+     * @brief Starts a reader thread for a port and asks it to open the port
+     * @param name System name or device path of the port
+     * @param baudRate Baud rate to configure
+     */
+    void openPort(const QString &name, qint32 baudRate);
+
+    /**
+     * @brief Closes a port and stops its reader thread
+     * @param index Index in ports
+     *
+     * @details Samples still queued by the reader are merged into the
+     *          stream first, as far as the other ports allow.
+     */
+    void closePort(int index);
+
+    /**
+     * @brief Index of a port in ports
+     * @return Index, or -1 if the port is not open
+     */
+    int findPort(const QString &name) const;
+
+    /**
+     * @brief Index of the port served by a reader
+     * @return Index, or -1 if the reader was already removed
+     */
+    int findPort(const SerialReader *reader) const;
+
+    /**
+     * @brief Reacts to a reader opening or closing its port
+     * @param reader Reader reporting the change
+     * @param connected true when the port is open
+     * @param error Error description when opening failed
+     */
+    void onConnectionChanged(SerialReader *reader, bool connected, const QString &error);
+
+    /**
+     * @brief Accumulates one decoded sample for the next display frame
+     * @param sample Validated sample of any frame type
+     * @param scaled SI values of an IMU sample converted in advance (replay
+     *        chunks), nullptr to convert in ImuBank::store()
+     *
+     * @details Dispatches on the frame type with dispatchSample() over
+     *          AsciiFrames; samples of an unknown type are ignored.
      */
-    void updateConnectionStatus(bool connected);
+    void processSample(const PlatformSample &sample, const float *scaled = nullptr);
+
+    /**
+     * @brief Handles an IMU sample (slot, statistics, spectrum, trail, error plot)
+     */
+    void processImuSample(const PlatformSample &sample, const float *scaled);
+
+    /**
+     * @brief Handles a servo sample (bars and forward kinematics pose)
+     */
+    void processServoSample(const PlatformSample &sample);
+
+    /**
+     * @brief Creates the display and comparison entry of a newly seen IMU
+     * @param slot Slot of the IMU in the bank
+     */
+    void addImu(int slot);
+
+    /**
+     * @brief Places the IMU displays in id order (four per column)
+     */
+    void layoutImuDisplays();
+
+    /**
+     * @struct Port
+     * @brief One serial device with its own reader thread
+     */
+    struct Port {
+        QString name;                     ///< Port name as selected by the user
+        QThread *thread = nullptr;        ///< Thread running the reader
+        SerialReader *reader = nullptr;   ///< Ingestion worker (lives in thread)
+        SessionRecorder::Input *recorderInput = nullptr; ///< Recording queue of the reader
+        bool connected = false;           ///< Port opened successfully
+        QString protocol;                 ///< Wire protocol detected by the reader ("ASCII"/"BIN")
+    };
 
     // === Serial communication ===
-    QSerialPort *serial;              ///< Handles low-level serial communication
+    QVector<Port> ports;              ///< Open (or opening) serial ports
+    SampleMerger merger;              ///< Timestamp-ordered merge of all reader queues
+    QTimer *mergeRetryTimer;          ///< Retries a merge that held samples back
+    QTimer *portStatsTimer;           ///< Refreshes the per-port counters in the status tooltip
     QPushButton *refreshButton;       ///< Triggers port list refresh (labeled "Ports ▼")
     QPushButton *languageButton;      ///< Toggles the application language
     QPushButton *connectButton;       ///< Toggles connection state (labeled "Connect"/"Disconnect")
+    QPushButton *recordButton;        ///< Toggles session recording
+    SessionRecorder recorder;         ///< Recording of all readers, merged by timestamp
     QComboBox *portComboBox;          ///< Dropdown list of available serial ports
+    QComboBox *baudComboBox;          ///< Editable baud rate selection
     QLabel *statusLabel;              ///< Visual indicator of connection status
 
+    // === Session replay ===
+    SessionReplay *replay;            ///< Player for recorded sessions
+    QPushButton *replayButton;        ///< Opens a session / stops the replay
+    QPushButton *pauseButton;         ///< Pauses and resumes the replay
+    QComboBox *speedComboBox;         ///< Replay speed (1x-100x, Max)
+    QLabel *replayLabel;              ///< Replay position and throughput
+    double replayPosition = 0;        ///< Last reported position (s)
+    double replayDuration = 0;        ///< Session duration (s)
+    double replayThroughput = 0;      ///< Last fast mode throughput (samples/s)
+    bool quitAfterReplay = false;     ///< Close the application when the replay ends
+
+    // === Latency diagnostics ===
+    LatencyMonitor latency;           ///< Byte arrival to screen statistics
+    LatencyProbe *latencyProbes[LatencyMonitor::StageCount] = {}; ///< Paint probes of the widget stages
+    LatencyPanel *latencyPanel;       ///< Live p50/p99/max table
+    QPushButton *latencyButton;       ///< Shows the latency panel
+    ImuStatistics statistics;         ///< Mean/RMS/peaks of every IMU axis and of the difference
+    StatisticsPanel *statisticsPanel; ///< Live statistics table
+    QPushButton *statisticsButton;    ///< Shows the statistics panel
+    SpectrumAnalyzer spectrum;        ///< Windowed FFT of every IMU axis (worker thread)
+    SpectrumPanel *spectrumPanel;     ///< Live spectrum and waterfall
+    QPushButton *spectrumButton;      ///< Shows the spectrum panel
+    QString latencyDumpPath;          ///< Report written at exit (optional)
+
+    // === IMUs ===
+    static constexpr int32_t referenceImuId = 1; ///< IMU driving the 3D view, G-force trace and error plot
+    ImuBank imus;                         ///< Latest readings of all IMUs (structure of arrays)
+    StewartKinematics servoKinematics;    ///< Platform pose from servo angles (warm-started)
+    QVector<IMUDisplay *> imuDisplays;    ///< Display per IMU slot, created on first sample
+    QVector<LatencyProbe *> imuProbes;    ///< Paint probe per IMU display
+    QGridLayout *imuGrid;                 ///< Layout of the IMU displays
+    QLabel *compareLabel;                 ///< Caption of compareComboBox
+    QComboBox *compareComboBox;           ///< IMU compared with the reference (slot as item data)
+    int compareSlot = -1;                 ///< Slot of the compared IMU, -1 if none
+    std::bitset<ImuBank::kMaxId + 2> rejectedImuIds; ///< IMU ids already reported as rejected (last bit: ids out of range)
+
     // === Visualization widgets ===
     PlatformViewer *platformViewer;       ///< 3D renderer for platform orientation visualization
-    IMUDisplay *imu1Display;              ///< Display widget for first IMU's sensor data
-    IMUDisplay *imu2Display;              ///< Display widget for second IMU's sensor data
     ImuGForceWidget *gForceWidget;        ///< Gravity vector visualization component
     HexagonBars *hexagonBars;            ///< Hexagonal servo position indicator
     ImuErrorPlotWidget *errorPlotWidget; ///< Difference plot between two IMUs
 
     /**
-     * @struct ImuData
-     * @brief Container for processed IMU sensor values
+     * @struct PendingFrame
+     * @brief Widget state accumulated between two display frames
      */
-    struct ImuData {
-        float ax;        ///< X-axis acceleration (scaled to m/s²)
-        float ay;        ///< Y-axis acceleration (scaled to m/s²)
-        float az;        ///< Z-axis acceleration (scaled to m/s²)
-        float gx;        ///< X-axis angular velocity (rad/s)
-        float gy;        ///< Y-axis angular velocity (rad/s)
-        float gz;        ///< Z-axis angular velocity (rad/s)
-        bool valid;      ///< Data validity flag (true when current data is usable)
+    struct PendingFrame {
+        bool platformDirty = false;            ///< Reference IMU orientation changed
+        bool servoDirty = false;               ///< New servo angles
+        QVector<int> servoAngles = QVector<int>(6, 0); ///< Latest servo angles
+        bool servoPoseDirty = false;           ///< New forward kinematics solution
+        StewartPose servoPose;                 ///< Pose solved from the latest servo angles
+        QVector<ImuGForceWidget::Sample> gForce; ///< Reference IMU G-force samples since the last frame
+        QVector<ImuErrorPlotWidget::Sample> errors; ///< IMU difference samples since the last frame
+        qint64 sourceNs[LatencyMonitor::StageCount] = {}; ///< Oldest arrival time per widget stage, 0 if none
 
         /**
-         * @brief Default constructor initializing all values to zero
+         * @brief Remembers the arrival time of the oldest data for a stage
          */
-        ImuData() : ax(0), ay(0), az(0), gx(0), gy(0), gz(0), valid(false) {}
+        void mark(LatencyMonitor::Stage stage, qint64 ns) { if (sourceNs[stage] == 0) sourceNs[stage] = ns; }
     };
 
-    ImuData imu1; ///< Data storage for first IMU unit
-    ImuData imu2; ///< Data storage for second IMU unit
+    PendingFrame pending;             ///< State waiting for the next frame
+    FrameScheduler *frameScheduler;   ///< Display-rate pacing of widget updates
 
     /**
      * @brief Handles translation and loading of language files.
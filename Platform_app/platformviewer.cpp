@@ -3,79 +3,32 @@
 #include <Qt3DCore/QEntity>
 #include <Qt3DCore/QTransform>
 #include <Qt3DExtras/QPhongMaterial>
+#include <Qt3DExtras/QPhongAlphaMaterial>
 #include <Qt3DExtras/QCuboidMesh>
 #include <Qt3DExtras/QOrbitCameraController>
 #include <QVBoxLayout>
 #include <Qt3DRender/QCamera>
 #include <QPointLight>
 #include <Qt3DExtras/QSphereMesh>
-#include <QTimer>
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
+#include "LatencyProbe.h"
+#include "PlatformSample.h"
+#include <QtMath>
 
-// Aktualizacja fizyki pilki
-void PlatformViewer::updateBallPhysics() {
-    const float deltaTime = 0.016f;   // ~60Hz
-    float gravityMag = m_gravityInput->text().toFloat();
-    const float friction = 0.98f;     // Tarcie
-    const float ballRadius = 0.5f;
-    const float platformTop = 0.25f;
-
-    // Obliczenie rotacji platformy i normalnej
-    QQuaternion platformRot = m_platformTransform->rotation();
-    QVector3D up = platformRot.rotatedVector(QVector3D(0, 1, 0));
-    QVector3D normal = up.normalized();
-
-    // Wektor grawitacji
-    QVector3D gravity(0, -gravityMag, 0);
-
-    // Projekcja grawitacji na platforme
-    QVector3D gravityOnPlane = gravity - QVector3D::dotProduct(gravity, normal) * normal;
-
-    // Aktualizacja predkosci pilki
-    m_ballVelocity += gravityOnPlane * deltaTime;
-
-    // Aktualizacja pozycji
-    QVector3D pos = m_ballTransform->translation();
-    normal = platformRot.rotatedVector(QVector3D(0, 1, 0)).normalized();
-
-    // Obliczenie wysokosci nad platforma
-    QVector3D platformPoint(0, 0.25f, 0);
-    float d = QVector3D::dotProduct(normal, platformPoint);
-    float ballY = (d - normal.x() * pos.x() - normal.z() * pos.z()) / normal.y();
-
-    // Sprawdzenie czy pilka jest na platformie
-    const float edgeMargin = ballRadius * (2.0f / 3.0f);
-
-    bool onPlatform =
-        pos.x() >= -3.0f + edgeMargin && pos.x() <= 3.0f - edgeMargin &&
-        pos.z() >= -2.0f + edgeMargin && pos.z() <= 2.0f - edgeMargin;
-
-    if (onPlatform && pos.y() - ballRadius <= ballY) {
-        // Ustawienie pilki na platformie
-        pos.setY(ballY + ballRadius);
-        m_ballVelocity.setY(0);
-    } else {
-        // Swobodny spadek
-        m_ballVelocity += gravity * deltaTime;
-    }
-
-    // Zastosowanie tarcia
-    m_ballVelocity.setX(m_ballVelocity.x() * friction);
-    m_ballVelocity.setZ(m_ballVelocity.z() * friction);
+// Skala sceny: jednostki sceny na metr ruchu platformy
+static const float kSceneUnitsPerMetre = 25.0f;
 
-    // Aktualizacja pozycji
-    pos += m_ballVelocity * deltaTime;
-
-    // Ustawienie nowej pozycji
-    m_ballTransform->setTranslation(pos);
+// Polozenie pilki dla renderowanej klatki
+void PlatformViewer::updateBallTransform() {
+    const BallSimulation::Vec3 pos = m_ballSimulation.position(monotonicNowNs());
+    m_ballTransform->setTranslation(QVector3D(pos.x, pos.y, pos.z));
 }
 
 // Resetowanie pozycji pilki
 void PlatformViewer::resetBall() {
-    m_ballVelocity = QVector3D(0, 0, 0);
-    m_ballTransform->setTranslation(QVector3D(0, 2.0f, 0));
+    m_ballSimulation.reset();
 }
 
 // Konstruktor PlatformViewer
@@ -108,6 +61,11 @@ PlatformViewer::PlatformViewer(QWidget *parent)
     controls->addSpacing(15);
     controls->addWidget(m_gravityInput);
 
+    // Grawitacja przekazywana do symulacji tylko przy zmianie
+    connect(m_gravityInput, &QLineEdit::textChanged, this, [this](const QString &text) {
+        m_ballSimulation.setGravity(text.toFloat());
+    });
+
     controls->addStretch();
 
     // Przycisk resetujacy pilke
@@ -116,6 +74,11 @@ PlatformViewer::PlatformViewer(QWidget *parent)
     controls->addWidget(resetButton);
     connect(resetButton, &QPushButton::clicked, this, &PlatformViewer::resetBall);
 
+    // Poza z serw i roznica wzgledem IMU
+    poseLabel = new QLabel();
+    layout->addWidget(poseLabel);
+    updatePoseLabel();
+
     // Glowna encja sceny
     Qt3DCore::QEntity *rootEntity = new Qt3DCore::QEntity();
 
@@ -152,6 +115,16 @@ PlatformViewer::PlatformViewer(QWidget *parent)
     platformEntity->addComponent(platformMesh);
     platformEntity->addComponent(material);
 
+    // Plyta w pozie wyliczonej z katow serw (polprzezroczysta)
+    Qt3DCore::QEntity *servoEntity = new Qt3DCore::QEntity(rootEntity);
+    m_servoTransform = new Qt3DCore::QTransform();
+    Qt3DExtras::QPhongAlphaMaterial *servoMaterial = new Qt3DExtras::QPhongAlphaMaterial();
+    servoMaterial->setDiffuse(QColor(QRgb(0x3070ff)));
+    servoMaterial->setAlpha(0.35f);
+    servoEntity->addComponent(platformMesh);
+    servoEntity->addComponent(servoMaterial);
+    servoEntity->addComponent(m_servoTransform);
+
     // Encja pilki
     m_ballEntity = new Qt3DCore::QEntity(rootEntity);
     m_ballTransform = new Qt3DCore::QTransform();
@@ -170,13 +143,9 @@ PlatformViewer::PlatformViewer(QWidget *parent)
     // Pozycja poczatkowa pilki
     m_ballTransform->setTranslation(QVector3D(0, 2.0f, 0));
 
-    // Predkosc poczatkowa
-    m_ballVelocity = QVector3D(0, 0, 0);
-
-    // Timer do aktualizacji fizyki
-    m_updateTimer = new QTimer(this);
-    connect(m_updateTimer, &QTimer::timeout, this, &PlatformViewer::updateBallPhysics);
-    m_updateTimer->start(16);
+    // Symulacja pilki na osobnym watku
+    m_ballSimulation.setGravity(m_gravityInput->text().toFloat());
+    m_ballSimulation.start();
 
     // Konfiguracja kamery
     m_view->camera()->lens()->setPerspectiveProjection(45.0f, 16.0f/9.0f, 0.1f, 1000.0f);
@@ -188,26 +157,64 @@ PlatformViewer::PlatformViewer(QWidget *parent)
         new Qt3DExtras::QOrbitCameraController(rootEntity);
     camController->setCamera(m_view->camera());
 
+    // Powiadomienie o kazdej klatce sceny (pomiar opoznien)
+    m_frameAction = new Qt3DLogic::QFrameAction(rootEntity);
+    rootEntity->addComponent(m_frameAction);
+    connect(m_frameAction, &Qt3DLogic::QFrameAction::triggered, this, &PlatformViewer::updateBallTransform);
+
     // Ustawienie glownej encji
     m_view->setRootEntity(rootEntity);
 }
 
-// Aktualizacja orientacji platformy na podstawie danych z IMU
-void PlatformViewer::updatePlatformOrientation(int ax, int ay, int az) {
-    // Normalizacja danych z akcelerometru
-    float normX = qBound(-1.0f, ax / 17000.0f, 1.0f);
-    float normY = qBound(-1.0f, ay / 17000.0f, 1.0f);
+// Aktualizacja orientacji platformy na podstawie filtru IMU
+void PlatformViewer::setPlatformOrientation(float w, float x, float y, float z) {
+    // Osie IMU w scenie: x -> X, y -> -Z, z -> Y (gora)
+    m_imuRotation = QQuaternion(w, x, z, -y);
+    m_platformTransform->setRotation(m_imuRotation);
+    m_ballSimulation.setPlatformOrientation(w, x, z, -y);
+}
+
+// Poza plyty z kinematyki prostej serw
+void PlatformViewer::setServoPose(const StewartPose &pose) {
+    double q[4];
+    stewartPoseQuaternion(pose, q);
+
+    // Osie platformy w scenie jak dla IMU: x -> X, y -> -Z, z -> Y
+    m_servoTransform->setRotation(QQuaternion(q[0], q[1], q[3], -q[2]));
+    m_servoTransform->setTranslation(QVector3D(pose.x, pose.z, -pose.y) * kSceneUnitsPerMetre);
 
-    // Konwersja na katy
-    float roll  = normX * 90.0f;
-    float pitch = normY * 90.0f;
+    m_servoPose = pose;
+    m_hasServoPose = true;
+    updatePoseLabel();
+}
+
+// Opis pozy serw i roznicy nachylenia wzgledem IMU
+void PlatformViewer::updatePoseLabel() {
+    if (!m_hasServoPose) {
+        poseLabel->setText(tr("Servo pose: no data"));
+        return;
+    }
 
-    // Ustawienie rotacji platformy
-    m_platformTransform->setRotation(QQuaternion::fromEulerAngles(pitch, 0, roll));
+    // Kat miedzy normalnymi plyt (odchylenie IMU nie jest obserwowalne)
+    const QVector3D imuUp = m_imuRotation.rotatedVector(QVector3D(0, 1, 0));
+    const QVector3D servoUp = m_servoTransform->rotation().rotatedVector(QVector3D(0, 1, 0));
+    const float cosine = qBound(-1.0f, QVector3D::dotProduct(imuUp, servoUp), 1.0f);
+    const float difference = qRadiansToDegrees(std::acos(cosine));
+
+    poseLabel->setText(tr("Servo pose: roll %1°, pitch %2°, heave %3 mm | IMU tilt difference: %4°")
+                           .arg(qRadiansToDegrees(m_servoPose.roll), 0, 'f', 1)
+                           .arg(qRadiansToDegrees(m_servoPose.pitch), 0, 'f', 1)
+                           .arg(m_servoPose.z * 1000.0, 0, 'f', 1)
+                           .arg(difference, 0, 'f', 1));
 }
 
+// Pomiar opoznienia do klatki Qt3D
+void PlatformViewer::setLatencyProbe(LatencyProbe *probe) {
+    connect(m_frameAction, &Qt3DLogic::QFrameAction::triggered, probe, &LatencyProbe::presented);
+}
 
 void PlatformViewer::retranslateUi() {
     gravityLabel->setText(tr("Gravity:"));
     resetButton->setText(tr("Reset Ball"));
+    updatePoseLabel();
 }
@@ -21,10 +21,16 @@
 #include <Qt3DCore/QEntity>
 #include <QPainter>
 #include <Qt3DCore/QTransform>
+#include <Qt3DLogic/QFrameAction>
 #include <QLineEdit>
 #include <QLabel>
 #include <QPushButton>
 
+#include "BallSimulation.h"
+#include "StewartKinematics.h"
+
+class LatencyProbe;
+
 /**
  * @class PlatformViewer
  * @brief 3D visualization widget for Stewart platform with physics simulation
@@ -40,6 +46,12 @@
  * - Virtual ball affected by platform tilt and gravity
  * - Gravity control interface
  * - Automatic physics updates
+ *
+ * A translucent second plate shows the pose solved from the servo angles,
+ * with the tilt difference to the IMU orientation shown below the view.
+ *
+ * The ball is simulated by BallSimulation on its own thread; the widget
+ * only passes inputs to it and places the ball once per rendered frame.
  */
 class PlatformViewer : public QWidget
 {
@@ -53,7 +65,7 @@ public:
      * @details Initializes:
      *          - 3D rendering environment
      *          - Platform and ball models
-     *          - Physics simulation timer
+     *          - Physics simulation thread
      *          - Gravity control interface
      */
     explicit PlatformViewer(QWidget *parent = nullptr);
@@ -65,17 +77,28 @@ public:
     QSize sizeHint() const override { return QSize(500, 400); }
 
     /**
-     * @brief Updates platform orientation from IMU data
-     * @param ax X-axis rotation (pitch) in raw IMU units
-     * @param ay Y-axis rotation (roll) in raw IMU units
-     * @param az Z-axis rotation (yaw) in raw IMU units
+     * @brief Updates platform orientation from the fused IMU estimate
+     * @param w,x,y,z Quaternion rotating the IMU frame to the earth frame (z up)
      *
-     * @details Converts raw IMU values to 3D transform:
-     *          - Applies platform rotation
-     *          - Maintains physical constraints
-     *          - Triggers visual update
+     * @details Maps the IMU axes to the scene (x right, y up, z towards
+     *          the viewer) and applies the rotation to the platform.
      */
-    void updatePlatformOrientation(int ax, int ay, int az);
+    void setPlatformOrientation(float w, float x, float y, float z);
+
+    /**
+     * @brief Shows the pose commanded by the servos next to the IMU pose
+     * @param pose Forward kinematics solution of the latest servo angles
+     *
+     * @details The difference is the angle between the plate normals,
+     *          since the IMU yaw is not observable.
+     */
+    void setServoPose(const StewartPose &pose);
+
+    /**
+     * @brief Reports rendered Qt3D frames to a latency probe
+     * @param probe Probe notified once per frame of the 3D scene
+     */
+    void setLatencyProbe(LatencyProbe *probe);
 
 
     /**
@@ -91,13 +114,17 @@ private:
     Qt3DExtras::Qt3DWindow *m_view;           ///< Main 3D rendering window
     QWidget *m_container;                     ///< Container for embedding Qt3D in QWidget
     Qt3DCore::QTransform *m_platformTransform;///< Platform's 3D transformation
+    Qt3DCore::QTransform *m_servoTransform;   ///< Transformation of the servo pose plate
+    QQuaternion m_imuRotation;                ///< Scene rotation from the IMU
+    StewartPose m_servoPose;                  ///< Latest servo pose
+    bool m_hasServoPose = false;              ///< Servo pose received
 
     Qt3DCore::QEntity *m_ballEntity;          ///< Virtual ball entity
-    QVector3D m_ballVelocity;                 ///< Current ball velocity (m/s)
     Qt3DCore::QTransform *m_ballTransform;    ///< Ball's 3D transformation
+    Qt3DLogic::QFrameAction *m_frameAction;   ///< Notified once per rendered frame
+    BallSimulation m_ballSimulation;          ///< Ball physics (own thread, 1 kHz)
 
     QLineEdit *m_gravityInput;                ///< Gravity magnitude input field
-    QTimer *m_updateTimer;                    ///< Physics update timer (60Hz)
 
     /**
  * @brief Label displaying gravity or related measurement information.
@@ -109,6 +136,16 @@ private:
  */
     QPushButton *resetButton;
 
+    /**
+     * @brief Servo pose and its difference to the IMU orientation
+     */
+    QLabel *poseLabel;
+
+    /**
+     * @brief Refreshes poseLabel from the stored poses
+     */
+    void updatePoseLabel();
+
     /**
      * @brief Initializes the 3D scene components
      *
@@ -131,15 +168,12 @@ private:
 
 private slots:
     /**
-     * @brief Updates ball physics simulation
+     * @brief Places the ball for the frame being rendered
      *
-     * @details Calculates each frame:
-     *          - Gravity effects based on platform tilt
-     *          - Collision detection with platform
-     *          - Velocity and position updates
-     *          - Energy loss on impact
+     * @details Called once per Qt3D frame with the position interpolated
+     *          by the simulation, so motion is smooth at any frame rate.
      */
-    void updateBallPhysics();
+    void updateBallTransform();
 
     /**
      * @brief Resets the ball to initial position
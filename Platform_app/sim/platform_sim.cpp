@@ -0,0 +1,374 @@
+/**
+ * @file    platform_sim.cpp
+ * @brief   Pseudo-terminal simulator of the platform controller
+ *
+ * @details Opens a Linux pty and streams valid "IMU:" and "S:" lines (or
+ *          COBS framed binary records) at configurable rates, so the
+ *          application can be tested without hardware:
+ *          - 1-16 IMUs (two by default) and six servos driven by a motion profile
+ *          - Servo angles from the platform inverse kinematics, so the pose
+ *            solved from them matches the pose seen by the IMUs
+ *          - Rates up to tens of kHz, paced in 1 ms batches
+ *          - Optional corruption: bad CRC, truncated lines, garbage bytes
+ *          - Bytes the reader does not consume in time are dropped, like a
+ *            UART overrun, to reproduce overload and resynchronization
+ *
+ * Usage: platform_sim [options]; the pty path to open in the application
+ *        is printed on start (or linked with --link).
+ *
+ * @author  Piotr Siembab
+ * @date    16.10.2026
+ * @version 1.0
+ */
+
+#include "BinaryProtocol.h"
+#include "FrameSchema.h"
+#include "StewartKinematics.h"
+
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <random>
+#include <string>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kAccelLsbPerG = 16384.0;   // Skala akcelerometru (profil +-2 g)
+constexpr double kGyroLsbPerDps = 65.5;     // Skala zyroskopu (LSB na stopien/s)
+constexpr long kTickNs = 1000000;           // Okres paczki danych (1 ms)
+
+volatile std::sig_atomic_t g_stop = 0;
+
+// Konfiguracja symulatora
+struct Options {
+    double imuRate = 500.0;       // Ramki na sekunde dla kazdego IMU
+    int imus = 2;                 // Liczba IMU (id 1..N)
+    double servoRate = 50.0;      // Ramki serw na sekunde
+    std::string profile = "sine"; // Profil ruchu
+    double badCrc = 0.0;          // Prawdopodobienstwo blednej sumy kontrolnej
+    double truncate = 0.0;        // Prawdopodobienstwo obcietej linii
+    double garbage = 0.0;         // Prawdopodobienstwo wstawienia smieci
+    bool binary = false;          // Protokol binarny zamiast tekstowego
+    double duration = 0.0;        // Czas dzialania (0 = bez limitu)
+    std::string link;             // Dowiazanie symboliczne do pty
+    unsigned seed = 1;            // Ziarno generatora losowego
+    bool quiet = false;           // Bez statystyk co sekunde
+};
+
+// Stan platformy w danej chwili
+struct Motion {
+    double roll = 0;    // Przechylenie (rad)
+    double pitch = 0;   // Pochylenie (rad)
+    double rollRate = 0;  // Predkosc katowa (rad/s)
+    double pitchRate = 0;
+    double yawRate = 0;
+    double vibration = 0; // Amplituda drgan (g)
+};
+
+void usage()
+{
+    std::fprintf(stderr,
+                 "Usage: platform_sim [options]\n"
+                 "  --imu-rate HZ      IMU frames per second per IMU (default 500)\n"
+                 "  --imus N           Number of IMUs with ids 1..N, 1-16 (default 2)\n"
+                 "  --servo-rate HZ    Servo frames per second (default 50)\n"
+                 "  --profile NAME     static | sine | circle | vibration | random (default sine)\n"
+                 "  --bad-crc P        Probability of a wrong checksum per frame\n"
+                 "  --truncate P       Probability of a frame cut short (no terminator)\n"
+                 "  --garbage P        Probability of random bytes between frames\n"
+                 "  --binary           Send COBS framed binary records instead of text\n"
+                 "  --duration S       Stop after S seconds\n"
+                 "  --link PATH        Create a symlink to the pty (e.g. /tmp/ttyPLATFORM)\n"
+                 "  --seed N           Random seed\n"
+                 "  --quiet            No per-second statistics\n");
+}
+
+bool parseOptions(int argc, char **argv, Options &options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--imu-rate" && hasValue) options.imuRate = std::atof(argv[++i]);
+        else if (arg == "--imus" && hasValue) options.imus = std::atoi(argv[++i]);
+        else if (arg == "--servo-rate" && hasValue) options.servoRate = std::atof(argv[++i]);
+        else if (arg == "--profile" && hasValue) options.profile = argv[++i];
+        else if (arg == "--bad-crc" && hasValue) options.badCrc = std::atof(argv[++i]);
+        else if (arg == "--truncate" && hasValue) options.truncate = std::atof(argv[++i]);
+        else if (arg == "--garbage" && hasValue) options.garbage = std::atof(argv[++i]);
+        else if (arg == "--binary") options.binary = true;
+        else if (arg == "--duration" && hasValue) options.duration = std::atof(argv[++i]);
+        else if (arg == "--link" && hasValue) options.link = argv[++i];
+        else if (arg == "--seed" && hasValue) options.seed = static_cast<unsigned>(std::atoi(argv[++i]));
+        else if (arg == "--quiet") options.quiet = true;
+        else return false;
+    }
+
+    const std::string &p = options.profile;
+    return options.imuRate >= 0 && options.servoRate >= 0 && options.imus >= 1 && options.imus <= 16
+           && (p == "static" || p == "sine" || p == "circle" || p == "vibration" || p == "random");
+}
+
+// Ruch platformy wedlug profilu
+Motion motionAt(const std::string &profile, double t, std::mt19937 &rng)
+{
+    Motion m;
+    if (profile == "sine") {
+        const double w = 2 * kPi * 0.5;
+        m.roll = 0.26 * std::sin(w * t);
+        m.rollRate = 0.26 * w * std::cos(w * t);
+        m.pitch = 0.17 * std::sin(w * 0.7 * t);
+        m.pitchRate = 0.17 * w * 0.7 * std::cos(w * 0.7 * t);
+    } else if (profile == "circle") {
+        const double w = 2 * kPi * 0.25;
+        m.roll = 0.2 * std::cos(w * t);
+        m.rollRate = -0.2 * w * std::sin(w * t);
+        m.pitch = 0.2 * std::sin(w * t);
+        m.pitchRate = 0.2 * w * std::cos(w * t);
+        m.yawRate = w;
+    } else if (profile == "vibration") {
+        m.vibration = 0.3;
+    } else if (profile == "random") {
+        // Bladzenie losowe z wygaszaniem
+        static double roll = 0, pitch = 0;
+        std::normal_distribution<double> step(0.0, 0.002);
+        const double droll = step(rng) - roll * 0.001;
+        const double dpitch = step(rng) - pitch * 0.001;
+        roll += droll;
+        pitch += dpitch;
+        m.roll = roll;
+        m.pitch = pitch;
+        m.vibration = 0.02;
+    }
+    return m;
+}
+
+inline int16_t clampInt16(double v)
+{
+    return static_cast<int16_t>(std::lround(std::fmax(-32768.0, std::fmin(32767.0, v))));
+}
+
+// Probka IMU dla danego ruchu (kolejne IMU maja staly offset i wiekszy szum)
+PlatformSample imuSample(int id, const Motion &m, double t, std::mt19937 &rng)
+{
+    std::normal_distribution<double> noise(0.0, id == 1 ? 0.003 : 0.006);
+    const double vib = m.vibration * std::sin(2 * kPi * 40.0 * t + id);
+    const double bias = 0.01 * (id - 1);
+
+    // Grawitacja w ukladzie czujnika dla R = Ry(pitch) * Rx(roll)
+    const double gx = -std::sin(m.pitch) + bias + noise(rng) + vib;
+    const double gy = std::sin(m.roll) * std::cos(m.pitch) + noise(rng) + vib * 0.5;
+    const double gz = std::cos(m.roll) * std::cos(m.pitch) + noise(rng);
+
+    PlatformSample s;
+    s.type = PlatformSample::Type::Imu;
+    s.imuId = id;
+    s.values[0] = clampInt16(gx * kAccelLsbPerG);
+    s.values[1] = clampInt16(gy * kAccelLsbPerG);
+    s.values[2] = clampInt16(gz * kAccelLsbPerG);
+    s.values[3] = clampInt16((m.rollRate * 180.0 / kPi + noise(rng) * 10) * kGyroLsbPerDps);
+    s.values[4] = clampInt16((m.pitchRate * 180.0 / kPi + noise(rng) * 10) * kGyroLsbPerDps);
+    s.values[5] = clampInt16((m.yawRate * 180.0 / kPi + noise(rng) * 10) * kGyroLsbPerDps);
+    return s;
+}
+
+// Katy serw odpowiadajace nachyleniu platformy (kinematyka odwrotna)
+PlatformSample servoSample(const Motion &m, const StewartKinematics &kinematics)
+{
+    PlatformSample s;
+    s.type = PlatformSample::Type::Servo;
+
+    StewartPose pose;
+    pose.roll = m.roll;
+    pose.pitch = m.pitch;
+    double angles[6] = {};
+    if (!kinematics.inverse(pose, angles)) {
+        for (double &angle : angles) angle = 0.0;  // Poza zasiegiem - pozycja zerowa
+    }
+
+    for (int i = 0; i < 6; ++i)
+        s.values[i] = static_cast<int16_t>(std::lround(std::fmax(-90.0, std::fmin(90.0, angles[i]))));
+    return s;
+}
+
+// Dopisanie ramki tekstowej (z opcjonalnym uszkodzeniem)
+void appendText(std::string &out, const PlatformSample &s, const Options &o, std::mt19937 &rng)
+{
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    const uint8_t crcXor = (chance(rng) < o.badCrc) ? static_cast<uint8_t>(1 + rng() % 255) : 0;
+
+    // Format ramki z opisu w FrameSchema.h (ten sam, z ktorego powstaje dekoder)
+    char line[96];
+    int n = static_cast<int>(formatSample(AsciiFrames(), s, crcXor, line, sizeof(line) - 2));
+    line[n++] = '\r';
+    line[n++] = '\n';
+
+    // Obciecie linii - brak zakonczenia, linia zlewa sie z nastepna
+    if (chance(rng) < o.truncate) n = 1 + static_cast<int>(rng() % static_cast<unsigned>(n - 2));
+    out.append(line, static_cast<std::size_t>(n));
+}
+
+// Dopisanie ramki binarnej (z opcjonalnym uszkodzeniem)
+void appendBinary(std::string &out, const PlatformSample &s, uint16_t sequence, const Options &o, std::mt19937 &rng)
+{
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    uint8_t frame[BinaryProtocol::kMaxFrameSize];
+    std::size_t n = BinaryProtocol::encode(s, sequence, frame);
+
+    // Zmiana bajtu danych (rozny od zera, aby nie zepsuc ramkowania) - blad CRC
+    if (chance(rng) < o.badCrc) {
+        uint8_t &b = frame[2 + rng() % (n - 3)];
+        b = static_cast<uint8_t>(b == 0xFF ? 0x01 : b + 1);
+    }
+    if (chance(rng) < o.truncate) n = 1 + rng() % (n - 2);
+    out.append(reinterpret_cast<const char *>(frame), n);
+}
+
+// Losowe bajty miedzy ramkami
+void appendGarbage(std::string &out, const Options &o, std::mt19937 &rng)
+{
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    if (chance(rng) >= o.garbage) return;
+    const int count = 1 + static_cast<int>(rng() % 16);
+    for (int i = 0; i < count; ++i) out.push_back(static_cast<char>(rng() & 0xFF));
+}
+
+double seconds(const timespec &a, const timespec &b)
+{
+    return (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) * 1e-9;
+}
+
+void onSignal(int)
+{
+    g_stop = 1;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+
+    // Otwarcie pseudo-terminala
+    const int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        std::perror("posix_openpt");
+        return 1;
+    }
+    const char *slavePath = ptsname(master);
+
+    // Tryb surowy po stronie odbiorcy; deskryptor trzymany, aby pty nie znikal po zamknieciu aplikacji
+    const int slave = open(slavePath, O_RDWR | O_NOCTTY);
+    if (slave >= 0) {
+        termios tio;
+        if (tcgetattr(slave, &tio) == 0) {
+            cfmakeraw(&tio);
+            tcsetattr(slave, TCSANOW, &tio);
+        }
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    if (!options.link.empty()) {
+        unlink(options.link.c_str());
+        if (symlink(slavePath, options.link.c_str()) != 0)
+            std::perror("symlink");
+    }
+
+    std::printf("%s\n", options.link.empty() ? slavePath : options.link.c_str());
+    std::fflush(stdout);
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::mt19937 rng(options.seed);
+    const StewartKinematics kinematics;
+    std::string out;
+    out.reserve(1 << 20);
+
+    timespec start, next;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    next = start;
+
+    unsigned long long imuSent = 0, servoSent = 0;
+    unsigned long long bytesWritten = 0, bytesDropped = 0;
+    unsigned long long lastFrames = 0, lastBytes = 0, lastDropped = 0;
+    double lastReport = 0;
+    uint16_t sequence = 0;
+
+    while (!g_stop) {
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        const double t = seconds(start, now);
+        if (options.duration > 0 && t >= options.duration) break;
+
+        // Ramki nalezne do tej chwili
+        const Motion motion = motionAt(options.profile, t, rng);
+        const auto imuDue = static_cast<unsigned long long>(t * options.imuRate);
+        const auto servoDue = static_cast<unsigned long long>(t * options.servoRate);
+
+        out.clear();
+        for (; imuSent < imuDue; ++imuSent) {
+            for (int id = 1; id <= options.imus; ++id) {
+                const PlatformSample s = imuSample(id, motion, t, rng);
+                if (options.binary) appendBinary(out, s, sequence++, options, rng);
+                else appendText(out, s, options, rng);
+                appendGarbage(out, options, rng);
+            }
+        }
+        for (; servoSent < servoDue; ++servoSent) {
+            const PlatformSample s = servoSample(motion, kinematics);
+            if (options.binary) appendBinary(out, s, sequence++, options, rng);
+            else appendText(out, s, options, rng);
+            appendGarbage(out, options, rng);
+        }
+
+        // Zapis bez blokowania; nadmiar jest tracony jak przy przepelnieniu UART
+        if (!out.empty()) {
+            const ssize_t written = write(master, out.data(), out.size());
+            if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EIO) {
+                std::perror("write");
+                break;
+            }
+            const std::size_t done = written > 0 ? static_cast<std::size_t>(written) : 0;
+            bytesWritten += done;
+            bytesDropped += out.size() - done;
+        }
+
+        // Statystyki co sekunde
+        if (!options.quiet && t - lastReport >= 1.0) {
+            const unsigned long long frames = imuSent * options.imus + servoSent;
+            std::fprintf(stderr, "t=%.0fs frames/s=%llu bytes/s=%llu dropped/s=%llu\n", t,
+                         frames - lastFrames, bytesWritten - lastBytes, bytesDropped - lastDropped);
+            lastFrames = frames;
+            lastBytes = bytesWritten;
+            lastDropped = bytesDropped;
+            lastReport = t;
+        }
+
+        // Nastepna paczka co 1 ms (czas bezwzgledny - bez dryfu)
+        next.tv_nsec += kTickNs;
+        if (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            ++next.tv_sec;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);
+    }
+
+    std::fprintf(stderr, "frames=%llu bytes=%llu dropped=%llu\n", imuSent * options.imus + servoSent, bytesWritten, bytesDropped);
+
+    if (!options.link.empty()) unlink(options.link.c_str());
+    if (slave >= 0) close(slave);
+    close(master);
+    return 0;
+}
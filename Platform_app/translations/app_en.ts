@@ -150,6 +150,116 @@
         <source>🇬🇧 EN</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="256"/>
+        <source>Invalid baud rate!</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="75"/>
+        <source>Record</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="362"/>
+        <source>Stop Recording</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="348"/>
+        <source>Save Session</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="349"/>
+        <source>Platform sessions (*.wds)</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="365"/>
+        <source>Failed to start recording: </source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="80"/>
+        <source>Replay...</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="82"/>
+        <source>Pause</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="470"/>
+        <source>Resume</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="89"/>
+        <source>Max</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="458"/>
+        <source>Stop Replay</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="431"/>
+        <source>Open Session</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="443"/>
+        <source>Failed to open session: </source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="497"/>
+        <source>samples/s</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="203"/>
+        <source>Finished: %1 samples/s</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="98"/>
+        <source>Latency</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="655"/>
+        <source>Error plot: IMU %1 minus</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="667"/>
+        <source>frames</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="668"/>
+        <source>errors</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="669"/>
+        <source>dropped</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="97"/>
+        <source>Statistics</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="101"/>
+        <source>Spectrum</source>
+        <translation type="unfinished"></translation>
+    </message>
 </context>
 <context>
     <name>PlatformViewer</name>
@@ -163,6 +273,16 @@
         <source>Reset Ball</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../platformviewer.cpp" line="194"/>
+        <source>Servo pose: no data</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../platformviewer.cpp" line="204"/>
+        <source>Servo pose: roll %1°, pitch %2°, heave %3 mm | IMU tilt difference: %4°</source>
+        <translation type="unfinished"></translation>
+    </message>
 </context>
 <context>
     <name>QObject</name>
@@ -171,5 +291,219 @@
         <source>Error</source>
         <translation type="unfinished"></translation>
     </message>
+    <message>
+        <location filename="../SessionFile.cpp" line="18"/>
+        <source>Not a session file</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SessionFile.cpp" line="23"/>
+        <source>Unsupported session file version</source>
+        <translation type="unfinished"></translation>
+    </message>
+</context>
+<context>
+    <name>LatencyPanel</name>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="76"/>
+        <source>Latency (byte arrival to screen)</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>Count</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>p50 [us]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>p99 [us]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>Max [us]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="84"/>
+        <source>Reset</source>
+        <translation type="unfinished"></translation>
+    </message>
+</context>
+<context>
+    <name>StatisticsPanel</name>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="86"/>
+        <source>IMU %1</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="113"/>
+        <source>IMU statistics</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="114"/>
+        <source>Source:</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="115"/>
+        <source>Window:</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="117"/>
+        <source>Difference (error plot)</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="121"/>
+        <source>1 s</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="122"/>
+        <source>10 s</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="123"/>
+        <source>60 s</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="124"/>
+        <source>Session</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Mean</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>RMS</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Std dev</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Min</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Max</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Count</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel X [m/s²]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel Y [m/s²]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel Z [m/s²]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro X [rad/s]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro Y [rad/s]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro Z [rad/s]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="130"/>
+        <source>Reset</source>
+        <translation type="unfinished"></translation>
+    </message>
+</context>
+<context>
+    <name>SpectrumPanel</name>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="188"/>
+        <source>Vibration spectrum</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="189"/>
+        <source>Source:</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="126"/>
+        <source>IMU %1</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="192"/>
+        <source>Accelerometer</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="193"/>
+        <source>Gyroscope</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="194"/>
+        <source>FFT size:</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="195"/>
+        <source>Waterfall</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="197"/>
+        <source>Amplitude spectrum (Hann window, 50% overlap)</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="198"/>
+        <source>Frequency [Hz]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="199"/>
+        <source>Amplitude [dB]</source>
+        <translation type="unfinished"></translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="180"/>
+        <source>Sample rate: %1 Hz, resolution: %2 Hz, dropped samples: %3</source>
+        <translation type="unfinished"></translation>
+    </message>
 </context>
 </TS>
@@ -150,6 +150,116 @@
         <source>🇬🇧 EN</source>
         <translation>🇵🇱 PL</translation>
     </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="256"/>
+        <source>Invalid baud rate!</source>
+        <translation>Nieprawidłowa prędkość transmisji!</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="75"/>
+        <source>Record</source>
+        <translation>Nagrywaj</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="362"/>
+        <source>Stop Recording</source>
+        <translation>Zatrzymaj nagrywanie</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="348"/>
+        <source>Save Session</source>
+        <translation>Zapisz sesję</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="349"/>
+        <source>Platform sessions (*.wds)</source>
+        <translation>Sesje platformy (*.wds)</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="365"/>
+        <source>Failed to start recording: </source>
+        <translation>Nie udało się rozpocząć nagrywania: </translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="80"/>
+        <source>Replay...</source>
+        <translation>Odtwórz...</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="82"/>
+        <source>Pause</source>
+        <translation>Wstrzymaj</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="470"/>
+        <source>Resume</source>
+        <translation>Wznów</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="89"/>
+        <source>Max</source>
+        <translation>Maks.</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="458"/>
+        <source>Stop Replay</source>
+        <translation>Zatrzymaj odtwarzanie</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="431"/>
+        <source>Open Session</source>
+        <translation>Otwórz sesję</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="443"/>
+        <source>Failed to open session: </source>
+        <translation>Nie udało się otworzyć sesji: </translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="497"/>
+        <source>samples/s</source>
+        <translation>próbek/s</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="203"/>
+        <source>Finished: %1 samples/s</source>
+        <translation>Zakończono: %1 próbek/s</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="98"/>
+        <source>Latency</source>
+        <translation>Opóźnienia</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="655"/>
+        <source>Error plot: IMU %1 minus</source>
+        <translation>Wykres błędów: IMU %1 minus</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="667"/>
+        <source>frames</source>
+        <translation>ramek</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="668"/>
+        <source>errors</source>
+        <translation>błędów</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="669"/>
+        <source>dropped</source>
+        <translation>utraconych</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="97"/>
+        <source>Statistics</source>
+        <translation>Statystyki</translation>
+    </message>
+    <message>
+        <location filename="../mainwindow.cpp" line="101"/>
+        <source>Spectrum</source>
+        <translation>Widmo</translation>
+    </message>
 </context>
 <context>
     <name>PlatformViewer</name>
@@ -163,6 +273,16 @@
         <source>Reset Ball</source>
         <translation>Zresetuj Piłkę</translation>
     </message>
+    <message>
+        <location filename="../platformviewer.cpp" line="194"/>
+        <source>Servo pose: no data</source>
+        <translation>Poza z serw: brak danych</translation>
+    </message>
+    <message>
+        <location filename="../platformviewer.cpp" line="204"/>
+        <source>Servo pose: roll %1°, pitch %2°, heave %3 mm | IMU tilt difference: %4°</source>
+        <translation>Poza z serw: przechył %1°, pochylenie %2°, wysokość %3 mm | różnica nachylenia IMU: %4°</translation>
+    </message>
 </context>
 <context>
     <name>QObject</name>
@@ -171,5 +291,219 @@
         <source>Error</source>
         <translation>Błąd</translation>
     </message>
+    <message>
+        <location filename="../SessionFile.cpp" line="18"/>
+        <source>Not a session file</source>
+        <translation>To nie jest plik sesji</translation>
+    </message>
+    <message>
+        <location filename="../SessionFile.cpp" line="23"/>
+        <source>Unsupported session file version</source>
+        <translation>Nieobsługiwana wersja pliku sesji</translation>
+    </message>
+</context>
+<context>
+    <name>LatencyPanel</name>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="76"/>
+        <source>Latency (byte arrival to screen)</source>
+        <translation>Opóźnienia (od odbioru bajtów do ekranu)</translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>Count</source>
+        <translation>Liczba</translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>p50 [us]</source>
+        <translation>p50 [µs]</translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>p99 [us]</source>
+        <translation>p99 [µs]</translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="77"/>
+        <source>Max [us]</source>
+        <translation>Maks. [µs]</translation>
+    </message>
+    <message>
+        <location filename="../LatencyPanel.cpp" line="84"/>
+        <source>Reset</source>
+        <translation>Zeruj</translation>
+    </message>
+</context>
+<context>
+    <name>StatisticsPanel</name>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="86"/>
+        <source>IMU %1</source>
+        <translation>IMU %1</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="113"/>
+        <source>IMU statistics</source>
+        <translation>Statystyki IMU</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="114"/>
+        <source>Source:</source>
+        <translation>Źródło:</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="115"/>
+        <source>Window:</source>
+        <translation>Okno:</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="117"/>
+        <source>Difference (error plot)</source>
+        <translation>Różnica (wykres błędów)</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="121"/>
+        <source>1 s</source>
+        <translation>1 s</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="122"/>
+        <source>10 s</source>
+        <translation>10 s</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="123"/>
+        <source>60 s</source>
+        <translation>60 s</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="124"/>
+        <source>Session</source>
+        <translation>Sesja</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Mean</source>
+        <translation>Średnia</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>RMS</source>
+        <translation>RMS</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Std dev</source>
+        <translation>Odch. std.</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Min</source>
+        <translation>Min</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Max</source>
+        <translation>Maks</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="126"/>
+        <source>Count</source>
+        <translation>Liczba</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel X [m/s²]</source>
+        <translation>Przysp. X [m/s²]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel Y [m/s²]</source>
+        <translation>Przysp. Y [m/s²]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="127"/>
+        <source>Accel Z [m/s²]</source>
+        <translation>Przysp. Z [m/s²]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro X [rad/s]</source>
+        <translation>Żyro X [rad/s]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro Y [rad/s]</source>
+        <translation>Żyro Y [rad/s]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="128"/>
+        <source>Gyro Z [rad/s]</source>
+        <translation>Żyro Z [rad/s]</translation>
+    </message>
+    <message>
+        <location filename="../StatisticsPanel.cpp" line="130"/>
+        <source>Reset</source>
+        <translation>Zeruj</translation>
+    </message>
+</context>
+<context>
+    <name>SpectrumPanel</name>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="188"/>
+        <source>Vibration spectrum</source>
+        <translation>Widmo drgań</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="189"/>
+        <source>Source:</source>
+        <translation>Źródło:</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="126"/>
+        <source>IMU %1</source>
+        <translation>IMU %1</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="192"/>
+        <source>Accelerometer</source>
+        <translation>Akcelerometr</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="193"/>
+        <source>Gyroscope</source>
+        <translation>Żyroskop</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="194"/>
+        <source>FFT size:</source>
+        <translation>Rozmiar FFT:</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="195"/>
+        <source>Waterfall</source>
+        <translation>Wodospad</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="197"/>
+        <source>Amplitude spectrum (Hann window, 50% overlap)</source>
+        <translation>Widmo amplitudowe (okno Hanna, nakładanie 50%)</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="198"/>
+        <source>Frequency [Hz]</source>
+        <translation>Częstotliwość [Hz]</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="199"/>
+        <source>Amplitude [dB]</source>
+        <translation>Amplituda [dB]</translation>
+    </message>
+    <message>
+        <location filename="../SpectrumPanel.cpp" line="180"/>
+        <source>Sample rate: %1 Hz, resolution: %2 Hz, dropped samples: %3</source>
+        <translation>Próbkowanie: %1 Hz, rozdzielczość: %2 Hz, utracone próbki: %3</translation>
+    </message>
 </context>
 </TS>